@@ -0,0 +1,105 @@
+#include "conjunctive_table_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/table_statistics.hpp"
+#include "table_scan.hpp"
+#include "table_scan_impl.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ConjunctiveTableScan::ConjunctiveTableScan(const std::shared_ptr<const AbstractOperator> in,
+                                           const std::vector<ScanPredicate>& predicates)
+    : AbstractOperator(in),
+      _predicates(predicates),
+      _max_thread_count(std::max(std::thread::hardware_concurrency(), 1u)) {
+  Assert(!_predicates.empty(), "A conjunctive scan needs at least one predicate.");
+  for (const auto& predicate : _predicates) {
+    Assert(predicate.scan_type != ScanType::OpBetween, "OpBetween needs an upper search value, use a TableScan.");
+  }
+}
+
+const std::vector<ScanPredicate>& ConjunctiveTableScan::predicates() const { return _predicates; }
+
+std::vector<ScanPredicate> ConjunctiveTableScan::evaluation_order(const Table& input_table) const {
+  const auto estimate_selectivity = [&](const ScanPredicate& predicate) {
+    if (input_table.chunk_count() == 0) return 1.0;
+
+    auto statistics = input_table.table_statistics();
+    auto column_id = predicate.column_id;
+    const auto segment = input_table.get_chunk(ChunkID{0}).get_segment(predicate.column_id);
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      statistics = reference_segment->referenced_table()->table_statistics();
+      column_id = reference_segment->referenced_column_id();
+    }
+    return statistics ? statistics->estimate_selectivity(column_id, predicate.scan_type, predicate.search_value) : 1.0;
+  };
+
+  auto selectivities = std::vector<std::pair<double, ScanPredicate>>{};
+  selectivities.reserve(_predicates.size());
+  for (const auto& predicate : _predicates) selectivities.emplace_back(estimate_selectivity(predicate), predicate);
+
+  // predicates with the same estimate keep the order in which they were given
+  std::stable_sort(selectivities.begin(), selectivities.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  auto ordered_predicates = std::vector<ScanPredicate>{};
+  ordered_predicates.reserve(selectivities.size());
+  for (const auto& [selectivity, predicate] : selectivities) ordered_predicates.push_back(predicate);
+  return ordered_predicates;
+}
+
+void ConjunctiveTableScan::set_max_thread_count(const size_t max_thread_count) {
+  DebugAssert(max_thread_count > 0, "A scan needs at least one thread.");
+  _max_thread_count = max_thread_count;
+}
+
+std::shared_ptr<const Table> ConjunctiveTableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto ordered_predicates = evaluation_order(*input_table);
+
+  auto impls = std::vector<std::unique_ptr<BaseTableScanImpl>>{};
+  impls.reserve(ordered_predicates.size());
+  for (const auto& predicate : ordered_predicates) {
+    impls.push_back(make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(
+        input_table->column_type(predicate.column_id), input_table, predicate.column_id, predicate.scan_type,
+        predicate.search_value));
+  }
+
+  const auto scan_chunk = [&](const Chunk& chunk, const ChunkID chunk_id, PosList& matches) {
+    for (const auto& impl : impls) {
+      if (impl->can_prune(chunk)) return;
+    }
+
+    impls.front()->scan_chunk(chunk, chunk_id, matches);
+
+    // the matches so far are the selection vector of the next predicate, which reads only the values of those rows
+    auto selection = PosList{};
+    for (auto predicate_index = size_t{1}; predicate_index < impls.size() && !matches.empty(); ++predicate_index) {
+      selection.swap(matches);
+      matches.clear();
+
+      const auto column_id = ordered_predicates[predicate_index].column_id;
+      const auto segment = chunk.get_segment(column_id);
+      if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+        impls[predicate_index]->scan_positions(*reference_segment->referenced_table(),
+                                               reference_segment->referenced_column_id(), selection, matches);
+      } else {
+        impls[predicate_index]->scan_positions(*input_table, column_id, selection, matches);
+      }
+    }
+  };
+
+  const auto thread_count = std::min({_max_thread_count, static_cast<size_t>(input_table->chunk_count()),
+                                      input_table->row_count() / TableScan::min_rows_per_thread});
+  return scan_table_chunks(input_table, std::max(thread_count, size_t{1}), scan_chunk);
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// a predicate `value <scan_type> search_value` on one column of the input of a ConjunctiveTableScan
+struct ScanPredicate {
+  ColumnID column_id;
+  ScanType scan_type;
+  AllTypeVariant search_value;
+};
+
+// ConjunctiveTableScan returns the rows of its input table that satisfy all of its predicates. Its output looks like
+// that of a TableScan, but unlike a chain of TableScans, it does not create a table of references for each predicate
+// only for the next scan to read and discard it.
+//
+// The predicates are evaluated chunk by chunk: the first one scans the whole chunk like a TableScan, and the positions
+// that match it are the selection vector that the next one is evaluated on, so later predicates only read the values
+// of rows that are still candidates. Chunks that the statistics of any predicate rule out are skipped without being
+// read. The predicate that the table statistics expect to match the fewest rows is evaluated first.
+class ConjunctiveTableScan : public AbstractOperator {
+ public:
+  ConjunctiveTableScan(const std::shared_ptr<const AbstractOperator> in, const std::vector<ScanPredicate>& predicates);
+
+  const std::vector<ScanPredicate>& predicates() const;
+
+  // returns the predicates in the order in which they are evaluated on the given input table, i.e., by ascending
+  // estimated selectivity. Predicates on ReferenceSegments are estimated with the statistics of the referenced table.
+  std::vector<ScanPredicate> evaluation_order(const Table& input_table) const;
+
+  // sets the number of threads that the scan uses at most, which defaults to the number of hardware threads
+  void set_max_thread_count(const size_t max_thread_count);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<ScanPredicate> _predicates;
+  size_t _max_thread_count;
+};
+
+}  // namespace opossum
@@ -4,11 +4,14 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
 #include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
 #include "storage/base_segment.hpp"
+#include "storage/segment_iterators.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
 #include "utils/performance_warning.hpp"
@@ -51,12 +54,11 @@ std::shared_ptr<const Table> Print::_on_execute() {
     }
 
     // print the rows in the chunk
+    const auto cells = _chunk_cells(*_input_table_left(), chunk);
     for (size_t row = 0; row < chunk.size(); ++row) {
       _out << "|";
       for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
-        // well yes, we use BaseSegment::operator[] here, but since Print is not an operation that should
-        // be part of a regular query plan, let's keep things simple here
-        _out << std::setw(widths[column_id]) << (*chunk.get_segment(column_id))[row] << "|" << std::setw(0);
+        _out << std::setw(widths[column_id]) << cells[column_id][row] << "|" << std::setw(0);
       }
 
       _out << std::endl;
@@ -77,13 +79,13 @@ std::vector<uint16_t> Print::column_string_widths(uint16_t min, uint16_t max, st
   }
 
   // go over all rows and find the maximum length of the printed representation of a value, up to max
-  for (ChunkID chunk_id{0}; chunk_id < _input_table_left()->chunk_count(); ++chunk_id) {
-    auto& chunk = _input_table_left()->get_chunk(chunk_id);
+  for (ChunkID chunk_id{0}; chunk_id < t->chunk_count(); ++chunk_id) {
+    auto& chunk = t->get_chunk(chunk_id);
 
+    const auto cells = _chunk_cells(*t, chunk);
     for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
-      for (size_t row = 0; row < chunk.size(); ++row) {
-        auto cell_length =
-            static_cast<uint16_t>(boost::lexical_cast<std::string>((*chunk.get_segment(column_id))[row]).size());
+      for (const auto& cell : cells[column_id]) {
+        auto cell_length = static_cast<uint16_t>(cell.size());
         widths[column_id] = std::max({min, widths[column_id], std::min(max, cell_length)});
       }
     }
@@ -91,4 +93,27 @@ std::vector<uint16_t> Print::column_string_widths(uint16_t min, uint16_t max, st
   return widths;
 }
 
+std::vector<std::vector<std::string>> Print::_chunk_cells(const Table& table, const Chunk& chunk) {
+  auto cells = std::vector<std::vector<std::string>>(chunk.column_count());
+  auto stream = std::ostringstream{};
+
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+    auto& column_cells = cells[column_id];
+    column_cells.resize(chunk.size());
+
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      segment_with_iterators<Type>(*chunk.get_segment(column_id), [&](auto it, const auto end) {
+        for (; it != end; ++it) {
+          const auto position = *it;
+          stream.str("");
+          stream << position.value();
+          column_cells[position.chunk_offset()] = stream.str();
+        }
+      });
+    });
+  }
+  return cells;
+}
+
 }  // namespace opossum
@@ -9,6 +9,9 @@
 
 namespace opossum {
 
+class Chunk;
+class Table;
+
 /**
  * operator to print the table with its data
  */
@@ -22,6 +25,9 @@ class Print : public AbstractOperator {
   std::vector<uint16_t> column_string_widths(uint16_t min, uint16_t max, std::shared_ptr<const Table> t) const;
   std::shared_ptr<const Table> _on_execute() override;
 
+  // returns the printed representation of all values of a chunk, column by column
+  static std::vector<std::vector<std::string>> _chunk_cells(const Table& table, const Chunk& chunk);
+
   // stream to print the result
   std::ostream& _out;
 };
@@ -0,0 +1,66 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "table_scan_impl.hpp"
+
+namespace opossum {
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value)
+    : AbstractOperator(in),
+      _column_id(column_id),
+      _scan_type(scan_type),
+      _search_value(search_value),
+      _max_thread_count(std::max(std::thread::hardware_concurrency(), 1u)) {
+  Assert(scan_type != ScanType::OpBetween, "OpBetween needs an upper search value.");
+}
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id,
+                     const AllTypeVariant lower_value, const AllTypeVariant upper_value, const bool lower_is_inclusive,
+                     const bool upper_is_inclusive)
+    : AbstractOperator(in),
+      _column_id(column_id),
+      _scan_type(ScanType::OpBetween),
+      _search_value(lower_value),
+      _upper_search_value(upper_value),
+      _lower_is_inclusive(lower_is_inclusive),
+      _upper_is_inclusive(upper_is_inclusive),
+      _max_thread_count(std::max(std::thread::hardware_concurrency(), 1u)) {}
+
+TableScan::~TableScan() = default;
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+const AllTypeVariant& TableScan::upper_search_value() const { return _upper_search_value; }
+
+bool TableScan::lower_is_inclusive() const { return _lower_is_inclusive; }
+
+bool TableScan::upper_is_inclusive() const { return _upper_is_inclusive; }
+
+void TableScan::set_max_thread_count(const size_t max_thread_count) {
+  DebugAssert(max_thread_count > 0, "A scan needs at least one thread.");
+  _max_thread_count = max_thread_count;
+}
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  _impl = make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(
+      input_table->column_type(_column_id), input_table, _column_id, _scan_type, _search_value, _upper_search_value,
+      _lower_is_inclusive, _upper_is_inclusive);
+
+  const auto thread_count = std::min({_max_thread_count, static_cast<size_t>(input_table->chunk_count()),
+                                      input_table->row_count() / min_rows_per_thread});
+  return _impl->on_execute(std::max(thread_count, size_t{1}));
+}
+
+}  // namespace opossum
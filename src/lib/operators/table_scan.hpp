@@ -15,19 +15,62 @@ namespace opossum {
 class BaseTableScanImpl;
 class Table;
 
+// TableScan returns the rows of its input table for which `value <scan_type> search_value` holds in the given column.
+// OpBetween scans for the values between a lower and an upper search value in a single pass, instead of a scan for each
+// bound where the second one would have to follow the references of the first.
+// The output references the scanned rows: it has one chunk per input chunk with matches, whose ReferenceSegments all
+// share one position list. If the input consists of ReferenceSegments, the output references their table instead, so
+// that scans on scans do not build chains of references.
+//
+// Chunks whose segment statistics show that they cannot contain a match are skipped without being read. Chunks that
+// have an index on the scanned column use it instead of reading the segment, except for OpNotEquals and for range
+// predicates on indexes that only support equality lookups. Chunks that are sorted by the scanned column are searched
+// with binary search and yield contiguous ranges of positions.
+//
+// Large inputs are scanned on several threads, which take chunks one after another and write each chunk's position
+// list to its own slot. The output chunks are then created in the order of the input chunks.
+//
+// The scan itself is implemented by a TableScanImpl for the data type of the scanned column, see table_scan_impl.hpp.
 class TableScan : public AbstractOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
             const AllTypeVariant search_value);
 
+  // scans for the values between `lower_value` and `upper_value` (OpBetween), which are included in the range or not
+  // as given
+  TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const AllTypeVariant lower_value,
+            const AllTypeVariant upper_value, const bool lower_is_inclusive = true,
+            const bool upper_is_inclusive = true);
+
   ~TableScan();
 
+  // inputs are only scanned on several threads if there are at least this many rows for each thread
+  static constexpr size_t min_rows_per_thread = size_t{1} << 16;
+
   ColumnID column_id() const;
   ScanType scan_type() const;
   const AllTypeVariant& search_value() const;
 
+  // the upper bound of OpBetween, whose lower bound is search_value()
+  const AllTypeVariant& upper_search_value() const;
+  bool lower_is_inclusive() const;
+  bool upper_is_inclusive() const;
+
+  // sets the number of threads that the scan uses at most, which defaults to the number of hardware threads
+  void set_max_thread_count(const size_t max_thread_count);
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+  const AllTypeVariant _upper_search_value;
+  const bool _lower_is_inclusive = true;
+  const bool _upper_is_inclusive = true;
+  size_t _max_thread_count;
+
+  std::unique_ptr<BaseTableScanImpl> _impl;
 };
 
 }  // namespace opossum
@@ -0,0 +1,569 @@
+#include "table_scan_impl.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/cold_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterators.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "table_scan_kernels.hpp"
+#include "type_cast.hpp"
+#include "utils/scan_type_utils.hpp"
+
+namespace opossum {
+
+namespace {
+
+// number of values that are handed to a scan kernel at once
+constexpr auto scan_block_size = ChunkOffset{1024};
+
+// The dictionary of a segment is sorted, so that a predicate on its values is equivalent to one on the value ids:
+// `value <scan_type> search_value` holds iff `value_id <predicate.scan_type> predicate.value_id`. OpBetween becomes the
+// interval of value ids [value_id, upper_value_id). Predicates that match no or all value ids are only flagged, and
+// intervals that start at the first or end after the last value id are reduced to a single comparison, so that the
+// remaining value ids are always smaller than the dictionary's size and fit into the attribute vector's width.
+struct ValueIDPredicate {
+  ValueIDPredicate(const BaseDictionarySegment& segment, const ScanType search_scan_type,
+                   const AllTypeVariant& search_value, const AllTypeVariant& upper_search_value,
+                   const bool lower_is_inclusive, const bool upper_is_inclusive) {
+    const auto value_id_count = static_cast<uint32_t>(segment.unique_values_count());
+    const auto to_bound = [&](const ValueID bound) {
+      return bound == INVALID_VALUE_ID ? value_id_count : static_cast<uint32_t>(bound);
+    };
+    const auto lower = to_bound(segment.lower_bound(search_value));
+    const auto upper = to_bound(segment.upper_bound(search_value));
+
+    // values in [lower, upper) are equal to the search value, and values below `bound` match
+    const auto set_less_than = [&](const uint32_t bound) {
+      scan_type = ScanType::OpLessThan;
+      value_id = bound;
+      matches_none = bound == 0;
+      matches_all = bound == value_id_count;
+    };
+    const auto set_greater_than_equals = [&](const uint32_t bound) {
+      scan_type = ScanType::OpGreaterThanEquals;
+      value_id = bound;
+      matches_none = bound == value_id_count;
+      matches_all = bound == 0;
+    };
+
+    switch (search_scan_type) {
+      case ScanType::OpEquals:
+      case ScanType::OpNotEquals:
+        scan_type = search_scan_type;
+        value_id = lower;
+        matches_none = lower == upper && search_scan_type == ScanType::OpEquals;
+        matches_all = lower == upper && search_scan_type == ScanType::OpNotEquals;
+        return;
+      case ScanType::OpLessThan:
+        set_less_than(lower);
+        return;
+      case ScanType::OpLessThanEquals:
+        set_less_than(upper);
+        return;
+      case ScanType::OpGreaterThan:
+        set_greater_than_equals(upper);
+        return;
+      case ScanType::OpGreaterThanEquals:
+        set_greater_than_equals(lower);
+        return;
+      case ScanType::OpBetween: {
+        const auto begin = lower_is_inclusive ? lower : upper;
+        const auto end = to_bound(upper_is_inclusive ? segment.upper_bound(upper_search_value)
+                                                     : segment.lower_bound(upper_search_value));
+        if (begin >= end) {
+          matches_none = true;
+        } else if (end == value_id_count) {
+          set_greater_than_equals(begin);
+        } else if (begin == 0) {
+          set_less_than(end);
+        } else {
+          scan_type = ScanType::OpBetween;
+          value_id = begin;
+          upper_value_id = end;
+        }
+        return;
+      }
+    }
+    Fail("Unknown scan type.");
+  }
+
+  // scans `count` value ids with the scan kernel, see scan_values()
+  template <typename ValueIDType>
+  size_t scan(const ValueIDType* value_ids, const size_t count, const ChunkOffset first_offset,
+              ChunkOffset* matches) const {
+    if (scan_type == ScanType::OpBetween) {
+      return scan_values_between(value_ids, count, static_cast<ValueIDType>(value_id),
+                                 static_cast<ValueIDType>(upper_value_id), true, false, first_offset, matches);
+    }
+    return scan_values(value_ids, count, scan_type, static_cast<ValueIDType>(value_id), first_offset, matches);
+  }
+
+  ScanType scan_type = ScanType::OpEquals;
+  uint32_t value_id = 0;
+  uint32_t upper_value_id = 0;
+  bool matches_none = false;
+  bool matches_all = false;
+};
+
+void append_all(const ChunkID chunk_id, const ChunkOffset size, PosList& matches) {
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    matches.push_back(RowID{chunk_id, chunk_offset});
+  }
+}
+
+// Scans `size` values block by block and appends the positions of all matches. scan_block(first_offset, count,
+// chunk_offsets) scans the `count` values starting at `first_offset` with a scan kernel and returns the match count.
+template <typename ScanBlock>
+void scan_blocks(const ChunkOffset size, const ScanBlock& scan_block, const ChunkID chunk_id, PosList& matches) {
+  auto chunk_offsets = std::array<ChunkOffset, scan_block_size>{};
+  for (auto block_begin = ChunkOffset{0}; block_begin < size; block_begin += scan_block_size) {
+    const auto block_size = std::min(scan_block_size, size - block_begin);
+    const auto match_count = scan_block(block_begin, block_size, chunk_offsets.data());
+    for (auto index = size_t{0}; index < match_count; ++index) matches.push_back(RowID{chunk_id, chunk_offsets[index]});
+  }
+}
+
+// FixedSizeAttributeVectors are scanned in place, with a kernel for the width of their value ids
+template <typename ValueIDType>
+void scan_attribute_vector(const FixedSizeAttributeVector<ValueIDType>& attribute_vector,
+                           const ValueIDPredicate& predicate, const ChunkID chunk_id, PosList& matches) {
+  const auto* value_ids = attribute_vector.values().data();
+  const auto scan_block = [&](const ChunkOffset block_begin, const ChunkOffset block_size, ChunkOffset* matches) {
+    return predicate.scan(value_ids + block_begin, block_size, block_begin, matches);
+  };
+  scan_blocks(static_cast<ChunkOffset>(attribute_vector.size()), scan_block, chunk_id, matches);
+}
+
+// all other attribute vectors are decoded to 32-bit value ids block by block first
+template <typename AttributeVector>
+void scan_attribute_vector(const AttributeVector& attribute_vector, const ValueIDPredicate& predicate,
+                           const ChunkID chunk_id, PosList& matches) {
+  static_assert(sizeof(ValueID) == sizeof(uint32_t), "Value ids are scanned as plain uint32_t");
+  auto value_ids = std::array<ValueID, scan_block_size>{};
+  const auto scan_block = [&](const ChunkOffset block_begin, const ChunkOffset block_size, ChunkOffset* matches) {
+    attribute_vector.decode(block_begin, block_size, value_ids.data());
+    return predicate.scan(reinterpret_cast<const uint32_t*>(value_ids.data()), block_size, block_begin, matches);
+  };
+  scan_blocks(static_cast<ChunkOffset>(attribute_vector.size()), scan_block, chunk_id, matches);
+}
+
+// Scans the values that get_value(index) returns for all indexes below `count`, which are gathered block by block into
+// a buffer. scan_block(values, count, matches) scans a buffer like scan_values(). Calls on_match(index) for each match.
+template <typename GetValue, typename ScanBlock, typename OnMatch>
+void scan_gathered(const size_t count, const GetValue& get_value, const ScanBlock& scan_block,
+                   const OnMatch& on_match) {
+  using Value = std::decay_t<decltype(get_value(size_t{0}))>;
+  auto values = std::array<Value, scan_block_size>{};
+  auto block_indexes = std::array<ChunkOffset, scan_block_size>{};
+  for (auto block_begin = size_t{0}; block_begin < count; block_begin += scan_block_size) {
+    const auto block_size = std::min(size_t{scan_block_size}, count - block_begin);
+    for (auto index = size_t{0}; index < block_size; ++index) values[index] = get_value(block_begin + index);
+    const auto match_count = scan_block(values.data(), block_size, block_indexes.data());
+    for (auto match = size_t{0}; match < match_count; ++match) on_match(block_begin + block_indexes[match]);
+  }
+}
+
+// returns an index on the given column of the chunk that is worth scanning, or nullptr if there is none. For
+// OpNotEquals, nearly all rows usually match, so reading the segment sequentially is cheaper than sorting the index's
+// results.
+std::shared_ptr<BaseIndex> find_scan_index(const Chunk& chunk, const ColumnID column_id, const ScanType scan_type) {
+  if (scan_type == ScanType::OpNotEquals) return nullptr;
+  for (const auto& index : chunk.get_indexes(column_id)) {
+    if (scan_type == ScanType::OpEquals || index->supports_range_lookups()) return index;
+  }
+  return nullptr;
+}
+
+// returns a chunk whose segments all reference the rows in `pos_list`. Columns of the input chunk that already consist
+// of ReferenceSegments are resolved to the table they reference.
+Chunk make_output_chunk(const std::shared_ptr<const Table>& input_table, const Chunk& input_chunk,
+                        const std::shared_ptr<const PosList>& pos_list) {
+  auto output_chunk = Chunk{};
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    const auto input_segment = input_chunk.get_segment(column_id);
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(input_segment)) {
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(reference_segment->referenced_table(),
+                                                                  reference_segment->referenced_column_id(), pos_list));
+    } else {
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+    }
+  }
+  return output_chunk;
+}
+
+// ColdSegments are decompressed once and scanned as the segment they rebuild, not value by value through operator[]
+std::shared_ptr<const BaseSegment> unwrap_cold_segment(std::shared_ptr<const BaseSegment> segment) {
+  if (const auto cold_segment = std::dynamic_pointer_cast<const ColdSegment>(segment)) return cold_segment->segment();
+  return segment;
+}
+
+}  // namespace
+
+std::shared_ptr<const Table> scan_table_chunks(
+    const std::shared_ptr<const Table>& input_table, const size_t thread_count,
+    const std::function<void(const Chunk& chunk, const ChunkID chunk_id, PosList& matches)>& scan_chunk) {
+  auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  // Each chunk's matches go to the position list in its own slot, so that threads never write to the same one. All
+  // output segments of a chunk share its position list.
+  const auto chunk_count = input_table->chunk_count();
+  auto pos_lists = std::vector<std::shared_ptr<PosList>>(chunk_count);
+  auto next_chunk_id = std::atomic<ChunkID::base_type>{0};
+  const auto scan_chunks = [&]() {
+    for (auto chunk_id = ChunkID{next_chunk_id++}; chunk_id < chunk_count; chunk_id = ChunkID{next_chunk_id++}) {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+      if (chunk.size() == 0) continue;
+
+      auto pos_list = std::make_shared<PosList>();
+      scan_chunk(chunk, chunk_id, *pos_list);
+      pos_lists[chunk_id] = std::move(pos_list);
+    }
+  };
+
+  if (thread_count == 1) {
+    scan_chunks();
+  } else {
+    // chunks are handed out one at a time, so that threads that skip chunks by their statistics take on more of them
+    auto threads = std::vector<std::thread>{};
+    threads.reserve(thread_count);
+    for (auto thread_index = size_t{0}; thread_index < thread_count; ++thread_index) threads.emplace_back(scan_chunks);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!pos_lists[chunk_id] || pos_lists[chunk_id]->empty()) continue;
+    output_table->emplace_chunk(make_output_chunk(input_table, input_table->get_chunk(chunk_id), pos_lists[chunk_id]));
+  }
+
+  // an empty result still has to have segments, so that its columns can be accessed
+  if (output_table->row_count() == 0 && input_table->chunk_count() > 0) {
+    output_table->emplace_chunk(make_output_chunk(input_table, input_table->get_chunk(ChunkID{0}),
+                                                  std::make_shared<PosList>()));
+  }
+
+  return output_table;
+}
+
+BaseTableScanImpl::BaseTableScanImpl(const std::shared_ptr<const Table>& input_table, const ColumnID column_id,
+                                     const ScanType scan_type, const AllTypeVariant& search_value,
+                                     const AllTypeVariant& upper_search_value, const bool lower_is_inclusive,
+                                     const bool upper_is_inclusive)
+    : _input_table(input_table),
+      _column_id(column_id),
+      _scan_type(scan_type),
+      _search_value(search_value),
+      _upper_search_value(upper_search_value),
+      _lower_is_inclusive(lower_is_inclusive),
+      _upper_is_inclusive(upper_is_inclusive) {}
+
+std::shared_ptr<const Table> BaseTableScanImpl::on_execute(const size_t thread_count) const {
+  const auto scan = [&](const Chunk& chunk, const ChunkID chunk_id, PosList& matches) {
+    scan_chunk(chunk, chunk_id, matches);
+  };
+  return scan_table_chunks(_input_table, thread_count, scan);
+}
+
+bool BaseTableScanImpl::can_prune(const Chunk& chunk) const { return _can_prune(chunk, _column_id); }
+
+bool BaseTableScanImpl::_can_prune(const Chunk& chunk, const ColumnID column_id) const {
+  const auto statistics = chunk.get_statistics(column_id);
+  if (!statistics) return false;
+  if (_scan_type != ScanType::OpBetween) return statistics->can_prune(_scan_type, _search_value);
+
+  // a chunk can be skipped if no value passes one of the bounds
+  const auto lower_scan_type = _lower_is_inclusive ? ScanType::OpGreaterThanEquals : ScanType::OpGreaterThan;
+  const auto upper_scan_type = _upper_is_inclusive ? ScanType::OpLessThanEquals : ScanType::OpLessThan;
+  return statistics->can_prune(lower_scan_type, _search_value) ||
+         statistics->can_prune(upper_scan_type, _upper_search_value);
+}
+
+template <typename T>
+TableScanImpl<T>::TableScanImpl(const std::shared_ptr<const Table>& input_table, const ColumnID column_id,
+                                const ScanType scan_type, const AllTypeVariant& search_value,
+                                const AllTypeVariant& upper_search_value, const bool lower_is_inclusive,
+                                const bool upper_is_inclusive)
+    : BaseTableScanImpl(input_table, column_id, scan_type, search_value, upper_search_value, lower_is_inclusive,
+                        upper_is_inclusive),
+      _typed_search_value(type_cast<T>(search_value)),
+      _typed_upper_search_value(scan_type == ScanType::OpBetween ? type_cast<T>(upper_search_value) : T{}) {}
+
+template <typename T>
+void TableScanImpl<T>::scan_chunk(const Chunk& chunk, const ChunkID chunk_id, PosList& matches) const {
+  const auto segment = unwrap_cold_segment(chunk.get_segment(_column_id));
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    return scan_positions(*reference_segment->referenced_table(), reference_segment->referenced_column_id(),
+                          *reference_segment->pos_list(), matches);
+  }
+
+  if (_can_prune(chunk, _column_id)) return;
+  chunk.mark_accessed();
+
+  if (const auto index = find_scan_index(chunk, _column_id, _scan_type)) {
+    _scan_index(*index, chunk_id, matches);
+  } else if (chunk.is_sorted_by(_column_id)) {
+    _scan_sorted_segment(*segment, chunk_id, matches);
+  } else if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) {
+    _scan_value_segment(*value_segment, chunk_id, matches);
+  } else if (const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)) {
+    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches);
+  } else {
+    _scan_other_segment(*segment, chunk_id, matches);
+  }
+}
+
+template <typename T>
+void TableScanImpl<T>::_scan_index(const BaseIndex& index, const ChunkID chunk_id, PosList& matches) const {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  if (_scan_type == ScanType::OpBetween) {
+    index.range_lookup(IndexBound{_search_value, _lower_is_inclusive},
+                       IndexBound{_upper_search_value, _upper_is_inclusive}, chunk_offsets);
+  } else {
+    index.scan(_scan_type, _search_value, chunk_offsets);
+  }
+  std::sort(chunk_offsets.begin(), chunk_offsets.end());
+  for (const auto chunk_offset : chunk_offsets) matches.push_back(RowID{chunk_id, chunk_offset});
+}
+
+template <typename T>
+void TableScanImpl<T>::_scan_value_segment(const ValueSegment<T>& segment, const ChunkID chunk_id,
+                                           PosList& matches) const {
+  const auto& values = segment.values();
+  if constexpr (has_scan_kernel<T>) {
+    const auto scan_block = [&](const ChunkOffset block_begin, const ChunkOffset block_size, ChunkOffset* matches) {
+      return _scan_values(values.data() + block_begin, block_size, block_begin, matches);
+    };
+    return scan_blocks(static_cast<ChunkOffset>(values.size()), scan_block, chunk_id, matches);
+  }
+
+  _with_value_predicate([&](const auto& is_match) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      if (is_match(values[chunk_offset])) matches.push_back(RowID{chunk_id, chunk_offset});
+    }
+  });
+}
+
+template <typename T>
+void TableScanImpl<T>::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
+                                                PosList& matches) const {
+  const auto predicate = ValueIDPredicate{segment, _scan_type, _search_value, _upper_search_value, _lower_is_inclusive,
+                                          _upper_is_inclusive};
+  if (predicate.matches_none) return;
+  if (predicate.matches_all) return append_all(chunk_id, static_cast<ChunkOffset>(segment.size()), matches);
+
+  with_attribute_vector(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    scan_attribute_vector(attribute_vector, predicate, chunk_id, matches);
+  });
+}
+
+template <typename T>
+void TableScanImpl<T>::_scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                            PosList& matches) const {
+  const auto size = static_cast<ChunkOffset>(segment.size());
+  with_segment_accessor<T>(segment, [&](const auto& accessor) {
+    // returns the first chunk offset whose value satisfies `is_match`, which has to hold for all following ones as well
+    const auto partition_point = [&](const auto& is_match) {
+      auto first = ChunkOffset{0};
+      auto count = size;
+      while (count > 0) {
+        const auto step = count / 2;
+        if (is_match(accessor(first + step))) {
+          count = step;
+        } else {
+          first += step + 1;
+          count -= step + 1;
+        }
+      }
+      return first;
+    };
+    // return the first chunk offset whose value is not less than / greater than `search_value`
+    const auto lower_bound = [&](const T& search_value) {
+      return partition_point([&](const T& value) { return !(value < search_value); });
+    };
+    const auto upper_bound = [&](const T& search_value) {
+      return partition_point([&](const T& value) { return search_value < value; });
+    };
+
+    // ranges whose end lies before their begin are empty
+    const auto append_range = [&](const ChunkOffset begin, const ChunkOffset end) {
+      for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+        matches.push_back(RowID{chunk_id, chunk_offset});
+      }
+    };
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        return append_range(lower_bound(_typed_search_value), upper_bound(_typed_search_value));
+      case ScanType::OpNotEquals:
+        append_range(0, lower_bound(_typed_search_value));
+        return append_range(upper_bound(_typed_search_value), size);
+      case ScanType::OpLessThan:
+        return append_range(0, lower_bound(_typed_search_value));
+      case ScanType::OpLessThanEquals:
+        return append_range(0, upper_bound(_typed_search_value));
+      case ScanType::OpGreaterThan:
+        return append_range(upper_bound(_typed_search_value), size);
+      case ScanType::OpGreaterThanEquals:
+        return append_range(lower_bound(_typed_search_value), size);
+      case ScanType::OpBetween: {
+        const auto begin =
+            _lower_is_inclusive ? lower_bound(_typed_search_value) : upper_bound(_typed_search_value);
+        const auto end =
+            _upper_is_inclusive ? upper_bound(_typed_upper_search_value) : lower_bound(_typed_upper_search_value);
+        return append_range(begin, end);
+      }
+    }
+    Fail("Unknown scan type.");
+  });
+}
+
+template <typename T>
+void TableScanImpl<T>::_scan_other_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                           PosList& matches) const {
+  _with_value_predicate([&](const auto& is_match) {
+    segment_with_iterators<T>(segment, [&](auto it, const auto end) {
+      for (; it != end; ++it) {
+        const auto& position = *it;
+        if (is_match(position.value())) {
+          matches.push_back(RowID{chunk_id, position.chunk_offset()});
+        }
+      }
+    });
+  });
+}
+
+template <typename T>
+void TableScanImpl<T>::scan_positions(const Table& referenced_table, const ColumnID referenced_column_id,
+                                      const PosList& positions, PosList& matches) const {
+  if (positions.empty()) return;
+
+  // Partitions the indexes into the position list by chunk id with a counting sort, which keeps them in ascending
+  // order within each chunk. Only the chunks between the lowest and the highest referenced one get a partition, so
+  // that positions within a few chunks of a large table are not partitioned over all of its chunks.
+  const auto chunk_id_range = std::minmax_element(
+      positions.cbegin(), positions.cend(),
+      [](const RowID& lhs, const RowID& rhs) { return lhs.chunk_id < rhs.chunk_id; });
+  const auto first_chunk_id = chunk_id_range.first->chunk_id;
+  const auto partition_count = size_t{chunk_id_range.second->chunk_id - first_chunk_id} + 1;
+  auto partition_begins = std::vector<size_t>(partition_count + 1);
+  for (const auto& row_id : positions) ++partition_begins[row_id.chunk_id - first_chunk_id + 1];
+  std::partial_sum(partition_begins.cbegin(), partition_begins.cend(), partition_begins.begin());
+  auto partitioned_indexes = std::vector<uint32_t>(positions.size());
+  auto write_positions = std::vector<size_t>(partition_begins.cbegin(), partition_begins.cend() - 1);
+  for (auto index = uint32_t{0}; index < positions.size(); ++index) {
+    partitioned_indexes[write_positions[positions[index].chunk_id - first_chunk_id]++] = index;
+  }
+
+  // not a std::vector<bool>, so that flags are set without reading and masking a word
+  auto is_match = std::vector<uint8_t>(positions.size());
+  for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+    const auto partition_size = partition_begins[partition + 1] - partition_begins[partition];
+    if (partition_size == 0) continue;
+
+    const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(first_chunk_id + partition)};
+    const auto& referenced_chunk = referenced_table.get_chunk(chunk_id);
+    if (_can_prune(referenced_chunk, referenced_column_id)) continue;
+    referenced_chunk.mark_accessed();
+    _scan_referenced_positions(*unwrap_cold_segment(referenced_chunk.get_segment(referenced_column_id)), positions,
+                               partitioned_indexes.data() + partition_begins[partition], partition_size, is_match);
+  }
+
+  for (auto index = size_t{0}; index < positions.size(); ++index) {
+    if (is_match[index]) matches.push_back(positions[index]);
+  }
+}
+
+template <typename T>
+void TableScanImpl<T>::_scan_referenced_positions(const BaseSegment& segment, const PosList& pos_list,
+                                                  const uint32_t* indexes, const size_t count,
+                                                  std::vector<uint8_t>& is_match) const {
+  const auto set_match = [&](const size_t index) { is_match[indexes[index]] = 1; };
+
+  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
+    const auto predicate = ValueIDPredicate{*dictionary_segment, _scan_type, _search_value, _upper_search_value,
+                                            _lower_is_inclusive, _upper_is_inclusive};
+    if (predicate.matches_none) return;
+    if (predicate.matches_all) {
+      for (auto index = size_t{0}; index < count; ++index) set_match(index);
+      return;
+    }
+
+    with_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      const auto get_value_id = [&](const size_t index) {
+        return static_cast<uint32_t>(attribute_vector.get(pos_list[indexes[index]].chunk_offset));
+      };
+      const auto scan_block = [&](const uint32_t* value_ids, const size_t block_size, ChunkOffset* block_matches) {
+        return predicate.scan(value_ids, block_size, 0, block_matches);
+      };
+      scan_gathered(count, get_value_id, scan_block, set_match);
+    });
+    return;
+  }
+
+  with_segment_accessor<T>(segment, [&](const auto& accessor) {
+    const auto get_value = [&](const size_t index) { return accessor(pos_list[indexes[index]].chunk_offset); };
+    if constexpr (has_scan_kernel<T>) {
+      const auto scan_block = [&](const T* values, const size_t block_size, ChunkOffset* block_matches) {
+        return _scan_values(values, block_size, 0, block_matches);
+      };
+      return scan_gathered(count, get_value, scan_block, set_match);
+    }
+
+    _with_value_predicate([&](const auto& is_match) {
+      for (auto index = size_t{0}; index < count; ++index) {
+        if (is_match(get_value(index))) set_match(index);
+      }
+    });
+  });
+}
+
+template <typename T>
+template <typename Functor>
+void TableScanImpl<T>::_with_value_predicate(const Functor& functor) const {
+  if (_scan_type == ScanType::OpBetween) {
+    return with_between_comparator(_lower_is_inclusive, _upper_is_inclusive, [&](auto is_between) {
+      functor([&](const T& value) { return is_between(value, _typed_search_value, _typed_upper_search_value); });
+    });
+  }
+
+  with_comparator(_scan_type, [&](auto comparator) {
+    functor([&](const T& value) { return comparator(value, _typed_search_value); });
+  });
+}
+
+template <typename T>
+size_t TableScanImpl<T>::_scan_values(const T* values, const size_t count, const ChunkOffset first_offset,
+                                      ChunkOffset* matches) const {
+  if constexpr (has_scan_kernel<T>) {
+    if (_scan_type == ScanType::OpBetween) {
+      return scan_values_between(values, count, _typed_search_value, _typed_upper_search_value, _lower_is_inclusive,
+                                 _upper_is_inclusive, first_offset, matches);
+    }
+    return scan_values(values, count, _scan_type, _typed_search_value, first_offset, matches);
+  }
+
+  Fail("There is no scan kernel for this type.");
+  return 0;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableScanImpl);
+
+}  // namespace opossum
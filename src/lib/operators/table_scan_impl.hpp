@@ -0,0 +1,121 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+class BaseIndex;
+class BaseSegment;
+class Chunk;
+class Table;
+
+template <typename T>
+class ValueSegment;
+
+// BaseTableScanImpl is the part of the TableScan that does not depend on the data type of the scanned column. The
+// TableScan creates a TableScanImpl for that type once per execution, so that segments are scanned with typed values
+// instead of AllTypeVariants.
+class BaseTableScanImpl : private Noncopyable {
+ public:
+  // the upper search value and the inclusiveness of the bounds are only used for OpBetween
+  BaseTableScanImpl(const std::shared_ptr<const Table>& input_table, const ColumnID column_id, const ScanType scan_type,
+                    const AllTypeVariant& search_value, const AllTypeVariant& upper_search_value,
+                    const bool lower_is_inclusive, const bool upper_is_inclusive);
+
+  virtual ~BaseTableScanImpl() = default;
+
+  // returns the table of all matching rows, see TableScan. The chunks are scanned on `thread_count` threads.
+  std::shared_ptr<const Table> on_execute(const size_t thread_count) const;
+
+  // returns whether the statistics of the scanned column of a chunk of the input table rule out any match
+  bool can_prune(const Chunk& chunk) const;
+
+  // appends the positions of all matching rows of a chunk of the input table. If the scanned column consists of
+  // ReferenceSegments, the positions point into the table they reference.
+  virtual void scan_chunk(const Chunk& chunk, const ChunkID chunk_id, PosList& matches) const = 0;
+
+  // appends those of `positions`, which point into `referenced_table`, whose value in the given column matches, in the
+  // order of `positions`
+  virtual void scan_positions(const Table& referenced_table, const ColumnID referenced_column_id,
+                              const PosList& positions, PosList& matches) const = 0;
+
+ protected:
+  // returns whether the statistics of the given column of a chunk rule out any match
+  bool _can_prune(const Chunk& chunk, const ColumnID column_id) const;
+
+  const std::shared_ptr<const Table> _input_table;
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+  const AllTypeVariant _upper_search_value;
+  const bool _lower_is_inclusive;
+  const bool _upper_is_inclusive;
+};
+
+// TableScanImpl scans each segment with the routine that fits its encoding:
+//  - ValueSegments compare their values with the search value directly.
+//  - Dictionary segments translate the search value into a range of value ids once and then only compare the integers
+//    in their attribute vector, without looking up any value in the dictionary. For OpBetween, both bounds together
+//    become a single interval of value ids.
+//  - ReferenceSegments are followed to the segments they reference, which are scanned like above.
+//  - All other segments are read through typed segment iterators.
+template <typename T>
+class TableScanImpl : public BaseTableScanImpl {
+ public:
+  TableScanImpl(const std::shared_ptr<const Table>& input_table, const ColumnID column_id, const ScanType scan_type,
+                const AllTypeVariant& search_value, const AllTypeVariant& upper_search_value = {},
+                const bool lower_is_inclusive = true, const bool upper_is_inclusive = true);
+
+  void scan_chunk(const Chunk& chunk, const ChunkID chunk_id, PosList& matches) const override;
+
+  // The positions are partitioned by the chunk they reference, so that each chunk is checked against its statistics
+  // once and the values at its referenced offsets are gathered for the scan kernels.
+  void scan_positions(const Table& referenced_table, const ColumnID referenced_column_id, const PosList& positions,
+                      PosList& matches) const override;
+
+ protected:
+  // Appends the positions of all matching rows as found by an index on the scanned segment. Indexes return chunk
+  // offsets ordered by value, so they are sorted to keep the rows in their original order.
+  void _scan_index(const BaseIndex& index, const ChunkID chunk_id, PosList& matches) const;
+
+  void _scan_value_segment(const ValueSegment<T>& segment, const ChunkID chunk_id, PosList& matches) const;
+
+  void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
+  // Appends the positions of all matching rows of a segment whose values are sorted in ascending order. The matches
+  // form at most two contiguous ranges, whose bounds are found by binary search.
+  void _scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
+  void _scan_other_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
+  // calls functor(is_match), where is_match(value) returns whether a value matches the scan
+  template <typename Functor>
+  void _with_value_predicate(const Functor& functor) const;
+
+  // scans `count` values with the scan kernel, see scan_values()
+  size_t _scan_values(const T* values, const size_t count, const ChunkOffset first_offset, ChunkOffset* matches) const;
+
+  // sets is_match[indexes[i]] for all i < count for which the row at `pos_list[indexes[i]]`, which lies in the given
+  // segment, matches
+  void _scan_referenced_positions(const BaseSegment& segment, const PosList& pos_list, const uint32_t* indexes,
+                                  const size_t count, std::vector<uint8_t>& is_match) const;
+
+  const T _typed_search_value;
+  const T _typed_upper_search_value;
+};
+
+// Calls scan_chunk(chunk, chunk_id, matches) for each non-empty chunk of `input_table` on `thread_count` threads and
+// returns a table with one chunk for each chunk with matches, in the order of the input chunks. All segments of an
+// output chunk reference its matches. Columns that consist of ReferenceSegments are resolved to the table they
+// reference, so the matches of such chunks have to point into that table.
+std::shared_ptr<const Table> scan_table_chunks(
+    const std::shared_ptr<const Table>& input_table, const size_t thread_count,
+    const std::function<void(const Chunk& chunk, const ChunkID chunk_id, PosList& matches)>& scan_chunk);
+
+}  // namespace opossum
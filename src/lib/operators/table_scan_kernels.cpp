@@ -0,0 +1,436 @@
+#include "table_scan_kernels.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define OPOSSUM_SCAN_KERNELS_X86 1
+#else
+#define OPOSSUM_SCAN_KERNELS_X86 0
+#endif
+
+#include <array>
+#include <type_traits>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <ScanType scan_type>
+using ScanTypeConstant = std::integral_constant<ScanType, scan_type>;
+
+// calls functor(ScanTypeConstant<scan_type>{}), so that kernels can be specialized for the scan type
+template <typename Functor>
+size_t with_scan_type(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return functor(ScanTypeConstant<ScanType::OpEquals>{});
+    case ScanType::OpNotEquals:
+      return functor(ScanTypeConstant<ScanType::OpNotEquals>{});
+    case ScanType::OpLessThan:
+      return functor(ScanTypeConstant<ScanType::OpLessThan>{});
+    case ScanType::OpLessThanEquals:
+      return functor(ScanTypeConstant<ScanType::OpLessThanEquals>{});
+    case ScanType::OpGreaterThan:
+      return functor(ScanTypeConstant<ScanType::OpGreaterThan>{});
+    case ScanType::OpGreaterThanEquals:
+      return functor(ScanTypeConstant<ScanType::OpGreaterThanEquals>{});
+    case ScanType::OpBetween:
+      Fail("OpBetween needs an upper search value, see scan_values_between().");
+      return 0;
+  }
+  Fail("Unknown scan type.");
+  return 0;
+}
+
+// calls functor(lower_scan_type, upper_scan_type) with the ScanTypeConstants that compare a value with the bounds
+template <typename Functor>
+size_t with_bound_scan_types(const bool lower_is_inclusive, const bool upper_is_inclusive, const Functor& functor) {
+  using GreaterThan = ScanTypeConstant<ScanType::OpGreaterThan>;
+  using GreaterThanEquals = ScanTypeConstant<ScanType::OpGreaterThanEquals>;
+  using LessThan = ScanTypeConstant<ScanType::OpLessThan>;
+  using LessThanEquals = ScanTypeConstant<ScanType::OpLessThanEquals>;
+  if (lower_is_inclusive) {
+    if (upper_is_inclusive) return functor(GreaterThanEquals{}, LessThanEquals{});
+    return functor(GreaterThanEquals{}, LessThan{});
+  }
+  if (upper_is_inclusive) return functor(GreaterThan{}, LessThanEquals{});
+  return functor(GreaterThan{}, LessThan{});
+}
+
+// OpGreaterThanEquals is the remaining case, OpBetween is never passed
+template <ScanType scan_type, typename T>
+bool compare(const T& value, const T& search_value) {
+  if constexpr (scan_type == ScanType::OpEquals) return value == search_value;
+  if constexpr (scan_type == ScanType::OpNotEquals) return value != search_value;
+  if constexpr (scan_type == ScanType::OpLessThan) return value < search_value;
+  if constexpr (scan_type == ScanType::OpLessThanEquals) return value <= search_value;
+  if constexpr (scan_type == ScanType::OpGreaterThan) return value > search_value;
+  return value >= search_value;
+}
+
+// The kernels are written against predicates, which compare a value with one search value or with the two bounds of
+// a range. Ranges are checked in the same pass, by combining the results of both comparisons.
+template <ScanType scan_type, typename T>
+struct Comparison {
+  bool operator()(const T& value) const { return compare<scan_type>(value, search_value); }
+
+  T search_value;
+};
+
+template <ScanType lower_scan_type, ScanType upper_scan_type, typename T>
+struct RangeComparison {
+  bool operator()(const T& value) const {
+    return compare<lower_scan_type>(value, lower_value) & compare<upper_scan_type>(value, upper_value);
+  }
+
+  T lower_value;
+  T upper_value;
+};
+
+template <typename T, typename Predicate>
+size_t scan_scalar(const T* values, const size_t count, const Predicate& predicate, const ChunkOffset first_offset,
+                   ChunkOffset* matches) {
+  auto match_count = size_t{0};
+  for (auto index = size_t{0}; index < count; ++index) {
+    matches[match_count] = first_offset + static_cast<ChunkOffset>(index);
+    match_count += predicate(values[index]);
+  }
+  return match_count;
+}
+
+#if OPOSSUM_SCAN_KERNELS_X86
+
+// The vectorized kernels compare 8 (AVX2) or 16 (AVX-512) values per iteration. Values narrower than 32 bits are
+// zero-extended to 32-bit lanes, so that the match mask has one bit per value and the offsets of all lanes fit into a
+// single register. The store of the compacted offsets always writes a whole register, but starts at the number of
+// matches so far, which is at most the index of the first compared value - so it stays within `count` offsets.
+
+// predicates of _mm512_cmp_*_mask for integers
+constexpr int to_integer_predicate(const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _MM_CMPINT_EQ;
+    case ScanType::OpNotEquals:
+      return _MM_CMPINT_NE;
+    case ScanType::OpLessThan:
+      return _MM_CMPINT_LT;
+    case ScanType::OpLessThanEquals:
+      return _MM_CMPINT_LE;
+    case ScanType::OpGreaterThan:
+      return _MM_CMPINT_NLE;
+    case ScanType::OpGreaterThanEquals:
+      return _MM_CMPINT_NLT;
+    case ScanType::OpBetween:
+      break;
+  }
+  return _MM_CMPINT_EQ;
+}
+
+// predicates of _mm256_cmp_* and _mm512_cmp_*_mask for floating point values. Like the scalar operators, all of them
+// except for OpNotEquals are false if a value is NaN.
+constexpr int to_floating_point_predicate(const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _CMP_EQ_OQ;
+    case ScanType::OpNotEquals:
+      return _CMP_NEQ_UQ;
+    case ScanType::OpLessThan:
+      return _CMP_LT_OQ;
+    case ScanType::OpLessThanEquals:
+      return _CMP_LE_OQ;
+    case ScanType::OpGreaterThan:
+      return _CMP_GT_OQ;
+    case ScanType::OpGreaterThanEquals:
+      return _CMP_GE_OQ;
+    case ScanType::OpBetween:
+      break;
+  }
+  return _CMP_EQ_OQ;
+}
+
+// the predicates have to be immediates, which constant variables are even in unoptimized builds
+template <ScanType scan_type>
+constexpr auto integer_predicate = to_integer_predicate(scan_type);
+
+template <ScanType scan_type>
+constexpr auto floating_point_predicate = to_floating_point_predicate(scan_type);
+
+// entry i holds the indexes of the set bits of i, followed by zeros, so that permuting a register with it moves the
+// lanes whose bit is set to the front
+constexpr std::array<std::array<uint32_t, 8>, 256> make_compaction_permutations() {
+  auto permutations = std::array<std::array<uint32_t, 8>, 256>{};
+  for (auto mask = uint32_t{0}; mask < 256; ++mask) {
+    auto position = size_t{0};
+    for (auto lane = uint32_t{0}; lane < 8; ++lane) {
+      if (mask & (uint32_t{1} << lane)) permutations[mask][position++] = lane;
+    }
+  }
+  return permutations;
+}
+
+constexpr auto compaction_permutations = make_compaction_permutations();
+
+__attribute__((target("avx2"))) uint32_t avx2_mask(const __m256i comparison) {
+  return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(comparison)));
+}
+
+// AVX2 only compares 32-bit integers for equality and "greater than", so the other predicates negate those.
+// OpGreaterThanEquals is the remaining case.
+template <ScanType scan_type>
+__attribute__((target("avx2"))) uint32_t avx2_compare(const __m256i values, const __m256i search_values) {
+  if constexpr (scan_type == ScanType::OpEquals) return avx2_mask(_mm256_cmpeq_epi32(values, search_values));
+  if constexpr (scan_type == ScanType::OpNotEquals) {
+    return ~avx2_mask(_mm256_cmpeq_epi32(values, search_values)) & 0xFF;
+  }
+  if constexpr (scan_type == ScanType::OpLessThan) return avx2_mask(_mm256_cmpgt_epi32(search_values, values));
+  if constexpr (scan_type == ScanType::OpLessThanEquals) {
+    return ~avx2_mask(_mm256_cmpgt_epi32(values, search_values)) & 0xFF;
+  }
+  if constexpr (scan_type == ScanType::OpGreaterThan) return avx2_mask(_mm256_cmpgt_epi32(values, search_values));
+  return ~avx2_mask(_mm256_cmpgt_epi32(search_values, values)) & 0xFF;
+}
+
+// returns the match mask of the eight values starting at `values`
+template <ScanType scan_type>
+__attribute__((target("avx2"))) uint32_t avx2_match_mask(const uint8_t* values, const uint8_t search_value) {
+  const auto widened_values = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)));
+  return avx2_compare<scan_type>(widened_values, _mm256_set1_epi32(search_value));
+}
+
+template <ScanType scan_type>
+__attribute__((target("avx2"))) uint32_t avx2_match_mask(const uint16_t* values, const uint16_t search_value) {
+  const auto widened_values = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+  return avx2_compare<scan_type>(widened_values, _mm256_set1_epi32(search_value));
+}
+
+// flipping the sign bit maps unsigned to signed integers in the same order
+template <ScanType scan_type>
+__attribute__((target("avx2"))) uint32_t avx2_match_mask(const uint32_t* values, const uint32_t search_value) {
+  const auto sign_bit = _mm256_set1_epi32(static_cast<int32_t>(0x80000000));
+  const auto signed_values = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)), sign_bit);
+  const auto signed_search_value = static_cast<int32_t>(search_value ^ 0x80000000);
+  return avx2_compare<scan_type>(signed_values, _mm256_set1_epi32(signed_search_value));
+}
+
+template <ScanType scan_type>
+__attribute__((target("avx2"))) uint32_t avx2_match_mask(const int32_t* values, const int32_t search_value) {
+  return avx2_compare<scan_type>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)),
+                                 _mm256_set1_epi32(search_value));
+}
+
+template <ScanType scan_type>
+__attribute__((target("avx2"))) uint32_t avx2_match_mask(const float* values, const float search_value) {
+  const auto comparison =
+      _mm256_cmp_ps(_mm256_loadu_ps(values), _mm256_set1_ps(search_value), floating_point_predicate<scan_type>);
+  return static_cast<uint32_t>(_mm256_movemask_ps(comparison));
+}
+
+template <ScanType scan_type>
+__attribute__((target("avx2"))) uint32_t avx2_match_mask(const double* values, const double search_value) {
+  const auto search_values = _mm256_set1_pd(search_value);
+  const auto low = _mm256_cmp_pd(_mm256_loadu_pd(values), search_values, floating_point_predicate<scan_type>);
+  const auto high = _mm256_cmp_pd(_mm256_loadu_pd(values + 4), search_values, floating_point_predicate<scan_type>);
+  return static_cast<uint32_t>(_mm256_movemask_pd(low) | (_mm256_movemask_pd(high) << 4));
+}
+
+template <ScanType scan_type, typename T>
+__attribute__((target("avx2"))) uint32_t avx2_match_mask(const T* values, const Comparison<scan_type, T>& predicate) {
+  return avx2_match_mask<scan_type>(values, predicate.search_value);
+}
+
+template <ScanType lower_scan_type, ScanType upper_scan_type, typename T>
+__attribute__((target("avx2"))) uint32_t avx2_match_mask(
+    const T* values, const RangeComparison<lower_scan_type, upper_scan_type, T>& predicate) {
+  return avx2_match_mask<lower_scan_type>(values, predicate.lower_value) &
+         avx2_match_mask<upper_scan_type>(values, predicate.upper_value);
+}
+
+template <typename T, typename Predicate>
+__attribute__((target("avx2"))) size_t scan_avx2(const T* values, const size_t count, const Predicate& predicate,
+                                                 const ChunkOffset first_offset, ChunkOffset* matches) {
+  auto offsets = _mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                  _mm256_set1_epi32(static_cast<int32_t>(first_offset)));
+  const auto lane_count = _mm256_set1_epi32(8);
+
+  auto match_count = size_t{0};
+  auto index = size_t{0};
+  for (; index + 8 <= count; index += 8) {
+    const auto mask = avx2_match_mask(values + index, predicate);
+    const auto permutation =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(compaction_permutations[mask].data()));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(matches + match_count),
+                        _mm256_permutevar8x32_epi32(offsets, permutation));
+    match_count += static_cast<size_t>(__builtin_popcount(mask));
+    offsets = _mm256_add_epi32(offsets, lane_count);
+  }
+
+  return match_count + scan_scalar(values + index, count - index, predicate,
+                                   first_offset + static_cast<ChunkOffset>(index), matches + match_count);
+}
+
+// returns the match mask of the sixteen values starting at `values`
+template <ScanType scan_type>
+__attribute__((target("avx512f"))) uint32_t avx512_match_mask(const uint8_t* values, const uint8_t search_value) {
+  // the zero-masked form avoids GCC's maybe-uninitialized warning on the unmasked intrinsic's pass-through operand
+  const auto widened_values =
+      _mm512_maskz_cvtepu8_epi32(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+  return _mm512_cmp_epu32_mask(widened_values, _mm512_set1_epi32(search_value), integer_predicate<scan_type>);
+}
+
+template <ScanType scan_type>
+__attribute__((target("avx512f"))) uint32_t avx512_match_mask(const uint16_t* values, const uint16_t search_value) {
+  const auto widened_values =
+      _mm512_maskz_cvtepu16_epi32(0xFFFF, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)));
+  return _mm512_cmp_epu32_mask(widened_values, _mm512_set1_epi32(search_value), integer_predicate<scan_type>);
+}
+
+template <ScanType scan_type>
+__attribute__((target("avx512f"))) uint32_t avx512_match_mask(const uint32_t* values, const uint32_t search_value) {
+  return _mm512_cmp_epu32_mask(_mm512_loadu_si512(values), _mm512_set1_epi32(static_cast<int32_t>(search_value)),
+                               integer_predicate<scan_type>);
+}
+
+template <ScanType scan_type>
+__attribute__((target("avx512f"))) uint32_t avx512_match_mask(const int32_t* values, const int32_t search_value) {
+  return _mm512_cmp_epi32_mask(_mm512_loadu_si512(values), _mm512_set1_epi32(search_value),
+                               integer_predicate<scan_type>);
+}
+
+template <ScanType scan_type>
+__attribute__((target("avx512f"))) uint32_t avx512_match_mask(const float* values, const float search_value) {
+  return _mm512_cmp_ps_mask(_mm512_loadu_ps(values), _mm512_set1_ps(search_value), floating_point_predicate<scan_type>);
+}
+
+template <ScanType scan_type>
+__attribute__((target("avx512f"))) uint32_t avx512_match_mask(const double* values, const double search_value) {
+  const auto search_values = _mm512_set1_pd(search_value);
+  const auto low = _mm512_cmp_pd_mask(_mm512_loadu_pd(values), search_values, floating_point_predicate<scan_type>);
+  const auto high = _mm512_cmp_pd_mask(_mm512_loadu_pd(values + 8), search_values, floating_point_predicate<scan_type>);
+  return static_cast<uint32_t>(low) | (static_cast<uint32_t>(high) << 8);
+}
+
+template <ScanType scan_type, typename T>
+__attribute__((target("avx512f"))) uint32_t avx512_match_mask(const T* values,
+                                                              const Comparison<scan_type, T>& predicate) {
+  return avx512_match_mask<scan_type>(values, predicate.search_value);
+}
+
+template <ScanType lower_scan_type, ScanType upper_scan_type, typename T>
+__attribute__((target("avx512f"))) uint32_t avx512_match_mask(
+    const T* values, const RangeComparison<lower_scan_type, upper_scan_type, T>& predicate) {
+  return avx512_match_mask<lower_scan_type>(values, predicate.lower_value) &
+         avx512_match_mask<upper_scan_type>(values, predicate.upper_value);
+}
+
+// AVX-512 compacts the offsets of the matching lanes itself, without a table of permutations
+template <typename T, typename Predicate>
+__attribute__((target("avx512f"))) size_t scan_avx512(const T* values, const size_t count,
+                                                      const Predicate& predicate, const ChunkOffset first_offset,
+                                                      ChunkOffset* matches) {
+  auto offsets = _mm512_add_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                                  _mm512_set1_epi32(static_cast<int32_t>(first_offset)));
+  const auto lane_count = _mm512_set1_epi32(16);
+
+  auto match_count = size_t{0};
+  auto index = size_t{0};
+  for (; index + 16 <= count; index += 16) {
+    const auto mask = avx512_match_mask(values + index, predicate);
+    _mm512_storeu_si512(matches + match_count, _mm512_maskz_compress_epi32(static_cast<__mmask16>(mask), offsets));
+    match_count += static_cast<size_t>(__builtin_popcount(mask));
+    offsets = _mm512_add_epi32(offsets, lane_count);
+  }
+
+  return match_count + scan_scalar(values + index, count - index, predicate,
+                                   first_offset + static_cast<ChunkOffset>(index), matches + match_count);
+}
+
+#endif
+
+template <typename T, typename Predicate>
+size_t scan_with_kernel(const T* values, const size_t count, const Predicate& predicate,
+                        const ChunkOffset first_offset, ChunkOffset* matches, const ScanKernel kernel) {
+  DebugAssert(is_supported(kernel), "Kernel is not supported on this CPU.");
+  switch (kernel) {
+#if OPOSSUM_SCAN_KERNELS_X86
+    case ScanKernel::Avx512:
+      return scan_avx512(values, count, predicate, first_offset, matches);
+    case ScanKernel::Avx2:
+      return scan_avx2(values, count, predicate, first_offset, matches);
+#endif
+    default:
+      return scan_scalar(values, count, predicate, first_offset, matches);
+  }
+}
+
+}  // namespace
+
+template <typename T>
+size_t scan_values(const T* values, const size_t count, const ScanType scan_type, const T search_value,
+                   const ChunkOffset first_offset, ChunkOffset* matches, const ScanKernel kernel) {
+  return with_scan_type(scan_type, [&](auto scan_type_constant) {
+    const auto predicate = Comparison<decltype(scan_type_constant)::value, T>{search_value};
+    return scan_with_kernel(values, count, predicate, first_offset, matches, kernel);
+  });
+}
+
+template <typename T>
+size_t scan_values_between(const T* values, const size_t count, const T lower_value, const T upper_value,
+                           const bool lower_is_inclusive, const bool upper_is_inclusive,
+                           const ChunkOffset first_offset, ChunkOffset* matches, const ScanKernel kernel) {
+  return with_bound_scan_types(lower_is_inclusive, upper_is_inclusive, [&](auto lower_scan_type, auto upper_scan_type) {
+    using Predicate = RangeComparison<decltype(lower_scan_type)::value, decltype(upper_scan_type)::value, T>;
+    const auto predicate = Predicate{lower_value, upper_value};
+    return scan_with_kernel(values, count, predicate, first_offset, matches, kernel);
+  });
+}
+
+ScanKernel scan_kernel() {
+  static const auto selected_kernel = is_supported(ScanKernel::Avx512) ? ScanKernel::Avx512
+                                      : is_supported(ScanKernel::Avx2) ? ScanKernel::Avx2
+                                                                       : ScanKernel::Scalar;
+  return selected_kernel;
+}
+
+bool is_supported(const ScanKernel kernel) {
+  switch (kernel) {
+#if OPOSSUM_SCAN_KERNELS_X86
+    case ScanKernel::Avx512:
+      return __builtin_cpu_supports("avx512f");
+    case ScanKernel::Avx2:
+      return __builtin_cpu_supports("avx2");
+#endif
+    case ScanKernel::Scalar:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template size_t scan_values<uint8_t>(const uint8_t*, const size_t, const ScanType, const uint8_t, const ChunkOffset,
+                                     ChunkOffset*, const ScanKernel);
+template size_t scan_values<uint16_t>(const uint16_t*, const size_t, const ScanType, const uint16_t,
+                                      const ChunkOffset, ChunkOffset*, const ScanKernel);
+template size_t scan_values<uint32_t>(const uint32_t*, const size_t, const ScanType, const uint32_t,
+                                      const ChunkOffset, ChunkOffset*, const ScanKernel);
+template size_t scan_values<int32_t>(const int32_t*, const size_t, const ScanType, const int32_t, const ChunkOffset,
+                                     ChunkOffset*, const ScanKernel);
+template size_t scan_values<float>(const float*, const size_t, const ScanType, const float, const ChunkOffset,
+                                   ChunkOffset*, const ScanKernel);
+template size_t scan_values<double>(const double*, const size_t, const ScanType, const double, const ChunkOffset,
+                                    ChunkOffset*, const ScanKernel);
+
+template size_t scan_values_between<uint8_t>(const uint8_t*, const size_t, const uint8_t, const uint8_t, const bool,
+                                             const bool, const ChunkOffset, ChunkOffset*, const ScanKernel);
+template size_t scan_values_between<uint16_t>(const uint16_t*, const size_t, const uint16_t, const uint16_t, const bool,
+                                              const bool, const ChunkOffset, ChunkOffset*, const ScanKernel);
+template size_t scan_values_between<uint32_t>(const uint32_t*, const size_t, const uint32_t, const uint32_t, const bool,
+                                              const bool, const ChunkOffset, ChunkOffset*, const ScanKernel);
+template size_t scan_values_between<int32_t>(const int32_t*, const size_t, const int32_t, const int32_t, const bool,
+                                             const bool, const ChunkOffset, ChunkOffset*, const ScanKernel);
+template size_t scan_values_between<float>(const float*, const size_t, const float, const float, const bool,
+                                           const bool, const ChunkOffset, ChunkOffset*, const ScanKernel);
+template size_t scan_values_between<double>(const double*, const size_t, const double, const double, const bool,
+                                            const bool, const ChunkOffset, ChunkOffset*, const ScanKernel);
+
+}  // namespace opossum
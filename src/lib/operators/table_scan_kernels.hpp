@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Scan kernels compare a contiguous array of values with a search value and write the offsets of all matches. They
+// never branch on the result of a comparison: the vectorized kernels compare a whole register at once, turn the result
+// into a bit mask and compact the offsets of the set bits with a single store, the scalar one always writes the offset
+// and only advances the output position on a match.
+//
+// Kernels exist for the value id widths of FixedSizeAttributeVectors (uint8_t, uint16_t and uint32_t) and for int,
+// float and double values. The kernel (AVX-512, AVX2 or scalar) is chosen once at runtime, depending on what the CPU
+// supports.
+enum class ScanKernel : uint8_t { Scalar, Avx2, Avx512 };
+
+// returns the kernel that is used on this CPU
+ScanKernel scan_kernel();
+
+// returns whether the given kernel can be executed on this CPU
+bool is_supported(const ScanKernel kernel);
+
+// whether scan_values() is implemented for the given type
+template <typename T>
+constexpr bool has_scan_kernel =
+    std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> || std::is_same_v<T, uint32_t> ||
+    std::is_same_v<T, int32_t> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+// Writes `first_offset + i` for each i < count for which `values[i] <scan_type> search_value` holds into `matches`, in
+// ascending order, and returns the number of matches. `matches` has to have room for `count` offsets.
+template <typename T>
+size_t scan_values(const T* values, const size_t count, const ScanType scan_type, const T search_value,
+                   const ChunkOffset first_offset, ChunkOffset* matches, const ScanKernel kernel = scan_kernel());
+
+// Same as scan_values(), but matches the values between `lower_value` and `upper_value`, which are included in the
+// range or not as given. Both bounds are checked in the same pass over the values.
+template <typename T>
+size_t scan_values_between(const T* values, const size_t count, const T lower_value, const T upper_value,
+                           const bool lower_is_inclusive, const bool upper_is_inclusive,
+                           const ChunkOffset first_offset, ChunkOffset* matches,
+                           const ScanKernel kernel = scan_kernel());
+
+}  // namespace opossum
@@ -0,0 +1,478 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "segment_iterators.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+enum class NodeType : uint8_t { Leaf, Node4, Node16, Node48, Node256 };
+
+}  // namespace
+
+struct AdaptiveRadixTree::Node {
+  explicit Node(const NodeType init_type) : type(init_type) {}
+  virtual ~Node() = default;
+
+  const NodeType type;
+};
+
+namespace {
+
+using Key = AdaptiveRadixTree::Key;
+using Node = AdaptiveRadixTree::Node;
+
+struct Leaf : Node {
+  Leaf(const Key& init_key, const ChunkOffset chunk_offset)
+      : Node(NodeType::Leaf), key(init_key), chunk_offsets{chunk_offset} {}
+
+  const Key key;
+  std::vector<ChunkOffset> chunk_offsets;
+};
+
+struct InnerNode : Node {
+  using Node::Node;
+
+  // the bytes that all keys below the node share after the byte that leads to it
+  Key prefix;
+  uint16_t child_count = 0;
+};
+
+// Node4 and Node16 keep the bytes of their children sorted and search them linearly
+template <NodeType node_type, size_t capacity>
+struct SortedNode : InnerNode {
+  SortedNode() : InnerNode(node_type) {}
+
+  std::array<uint8_t, capacity> bytes{};
+  std::array<std::unique_ptr<Node>, capacity> children;
+};
+
+using Node4 = SortedNode<NodeType::Node4, 4>;
+using Node16 = SortedNode<NodeType::Node16, 16>;
+
+// Node48 stores up to 48 children in the order they were added and maps each byte to the slot of its child plus one
+struct Node48 : InnerNode {
+  Node48() : InnerNode(NodeType::Node48) {}
+
+  std::array<uint8_t, 256> slots{};
+  std::array<std::unique_ptr<Node>, 48> children;
+};
+
+struct Node256 : InnerNode {
+  Node256() : InnerNode(NodeType::Node256) {}
+
+  std::array<std::unique_ptr<Node>, 256> children;
+};
+
+// returns the child for the given byte, or nullptr if there is none
+std::unique_ptr<Node>* find_child(InnerNode& node, const uint8_t byte) {
+  const auto find_sorted_child = [&](auto& sorted_node) -> std::unique_ptr<Node>* {
+    for (auto index = size_t{0}; index < sorted_node.child_count; ++index) {
+      if (sorted_node.bytes[index] == byte) return &sorted_node.children[index];
+    }
+    return nullptr;
+  };
+
+  switch (node.type) {
+    case NodeType::Node4:
+      return find_sorted_child(static_cast<Node4&>(node));
+    case NodeType::Node16:
+      return find_sorted_child(static_cast<Node16&>(node));
+    case NodeType::Node48: {
+      auto& node48 = static_cast<Node48&>(node);
+      return node48.slots[byte] ? &node48.children[node48.slots[byte] - 1] : nullptr;
+    }
+    case NodeType::Node256: {
+      auto& node256 = static_cast<Node256&>(node);
+      return node256.children[byte] ? &node256.children[byte] : nullptr;
+    }
+    case NodeType::Leaf:
+      break;
+  }
+  Fail("Leaves have no children.");
+  return nullptr;
+}
+
+const Node* find_child(const InnerNode& node, const uint8_t byte) {
+  const auto* child = find_child(const_cast<InnerNode&>(node), byte);
+  return child ? child->get() : nullptr;
+}
+
+// calls the functor with the byte and the node of each child, in the order of the bytes
+template <typename Functor>
+void for_each_child(const InnerNode& node, const Functor& functor) {
+  const auto for_each_sorted_child = [&](const auto& sorted_node) {
+    for (auto index = size_t{0}; index < sorted_node.child_count; ++index) {
+      functor(sorted_node.bytes[index], *sorted_node.children[index]);
+    }
+  };
+
+  switch (node.type) {
+    case NodeType::Node4:
+      return for_each_sorted_child(static_cast<const Node4&>(node));
+    case NodeType::Node16:
+      return for_each_sorted_child(static_cast<const Node16&>(node));
+    case NodeType::Node48: {
+      const auto& node48 = static_cast<const Node48&>(node);
+      for (auto byte = size_t{0}; byte < node48.slots.size(); ++byte) {
+        if (node48.slots[byte]) functor(static_cast<uint8_t>(byte), *node48.children[node48.slots[byte] - 1]);
+      }
+      return;
+    }
+    case NodeType::Node256: {
+      const auto& node256 = static_cast<const Node256&>(node);
+      for (auto byte = size_t{0}; byte < node256.children.size(); ++byte) {
+        if (node256.children[byte]) functor(static_cast<uint8_t>(byte), *node256.children[byte]);
+      }
+      return;
+    }
+    case NodeType::Leaf:
+      break;
+  }
+  Fail("Leaves have no children.");
+}
+
+template <typename SortedNodeType>
+void add_sorted_child(SortedNodeType& node, const uint8_t byte, std::unique_ptr<Node> child) {
+  auto position = size_t{0};
+  while (position < node.child_count && node.bytes[position] < byte) ++position;
+  for (auto index = size_t{node.child_count}; index > position; --index) {
+    node.bytes[index] = node.bytes[index - 1];
+    node.children[index] = std::move(node.children[index - 1]);
+  }
+  node.bytes[position] = byte;
+  node.children[position] = std::move(child);
+  ++node.child_count;
+}
+
+// returns a node of the next larger type that holds the children of the given full node
+std::unique_ptr<InnerNode> grow(InnerNode& node) {
+  switch (node.type) {
+    case NodeType::Node4: {
+      auto& node4 = static_cast<Node4&>(node);
+      auto node16 = std::make_unique<Node16>();
+      for (auto index = size_t{0}; index < node4.child_count; ++index) {
+        node16->bytes[index] = node4.bytes[index];
+        node16->children[index] = std::move(node4.children[index]);
+      }
+      node16->child_count = node4.child_count;
+      node16->prefix = std::move(node4.prefix);
+      return node16;
+    }
+    case NodeType::Node16: {
+      auto& node16 = static_cast<Node16&>(node);
+      auto node48 = std::make_unique<Node48>();
+      for (auto index = size_t{0}; index < node16.child_count; ++index) {
+        node48->slots[node16.bytes[index]] = static_cast<uint8_t>(index + 1);
+        node48->children[index] = std::move(node16.children[index]);
+      }
+      node48->child_count = node16.child_count;
+      node48->prefix = std::move(node16.prefix);
+      return node48;
+    }
+    case NodeType::Node48: {
+      auto& node48 = static_cast<Node48&>(node);
+      auto node256 = std::make_unique<Node256>();
+      for (auto byte = size_t{0}; byte < node48.slots.size(); ++byte) {
+        if (node48.slots[byte]) node256->children[byte] = std::move(node48.children[node48.slots[byte] - 1]);
+      }
+      node256->child_count = node48.child_count;
+      node256->prefix = std::move(node48.prefix);
+      return node256;
+    }
+    case NodeType::Node256:
+    case NodeType::Leaf:
+      break;
+  }
+  Fail("Only Node4, Node16 and Node48 can grow.");
+  return nullptr;
+}
+
+// adds a child for a byte that the inner node in `slot` has no child for yet, growing the node if it is full
+void add_child(std::unique_ptr<Node>& slot, const uint8_t byte, std::unique_ptr<Node> child) {
+  auto& node = static_cast<InnerNode&>(*slot);
+  switch (node.type) {
+    case NodeType::Node4:
+      if (node.child_count < 4) return add_sorted_child(static_cast<Node4&>(node), byte, std::move(child));
+      break;
+    case NodeType::Node16:
+      if (node.child_count < 16) return add_sorted_child(static_cast<Node16&>(node), byte, std::move(child));
+      break;
+    case NodeType::Node48:
+      if (node.child_count < 48) {
+        // children are never removed, so the slots are filled in order
+        auto& node48 = static_cast<Node48&>(node);
+        node48.slots[byte] = static_cast<uint8_t>(node48.child_count + 1);
+        node48.children[node48.child_count] = std::move(child);
+        ++node48.child_count;
+        return;
+      }
+      break;
+    case NodeType::Node256: {
+      auto& node256 = static_cast<Node256&>(node);
+      node256.children[byte] = std::move(child);
+      ++node256.child_count;
+      return;
+    }
+    case NodeType::Leaf:
+      Fail("Leaves have no children.");
+  }
+
+  slot = grow(node);
+  add_child(slot, byte, std::move(child));
+}
+
+// inserts a key into the subtree in `slot`, whose path consumes the first `depth` bytes of the key
+void insert_into(std::unique_ptr<Node>& slot, const Key& key, size_t depth, const ChunkOffset chunk_offset) {
+  if (!slot) {
+    slot = std::make_unique<Leaf>(key, chunk_offset);
+    return;
+  }
+
+  if (slot->type == NodeType::Leaf) {
+    auto& leaf = static_cast<Leaf&>(*slot);
+    if (leaf.key == key) {
+      leaf.chunk_offsets.push_back(chunk_offset);
+      return;
+    }
+
+    // the leaf is replaced by a node that branches at the first byte in which the keys differ
+    auto mismatch = depth;
+    while (mismatch < key.size() && mismatch < leaf.key.size() && key[mismatch] == leaf.key[mismatch]) ++mismatch;
+    DebugAssert(mismatch < key.size() && mismatch < leaf.key.size(), "A key must not be a prefix of another one.");
+
+    auto node = std::make_unique<Node4>();
+    node->prefix.assign(key.cbegin() + depth, key.cbegin() + mismatch);
+    const auto leaf_byte = leaf.key[mismatch];
+    add_sorted_child(*node, leaf_byte, std::move(slot));
+    add_sorted_child(*node, key[mismatch], std::make_unique<Leaf>(key, chunk_offset));
+    slot = std::move(node);
+    return;
+  }
+
+  auto& node = static_cast<InnerNode&>(*slot);
+  auto matched = size_t{0};
+  while (matched < node.prefix.size() && depth + matched < key.size() &&
+         node.prefix[matched] == key[depth + matched]) {
+    ++matched;
+  }
+
+  if (matched < node.prefix.size()) {
+    // the key leaves the node's prefix, so a new node branches where they differ
+    DebugAssert(depth + matched < key.size(), "A key must not be a prefix of another one.");
+    auto parent = std::make_unique<Node4>();
+    parent->prefix.assign(node.prefix.cbegin(), node.prefix.cbegin() + matched);
+    const auto node_byte = node.prefix[matched];
+    node.prefix.erase(node.prefix.begin(), node.prefix.begin() + matched + 1);
+    add_sorted_child(*parent, node_byte, std::move(slot));
+    add_sorted_child(*parent, key[depth + matched], std::make_unique<Leaf>(key, chunk_offset));
+    slot = std::move(parent);
+    return;
+  }
+
+  depth += node.prefix.size();
+  DebugAssert(depth < key.size(), "A key must not be a prefix of another one.");
+  if (auto* child = find_child(node, key[depth])) return insert_into(*child, key, depth + 1, chunk_offset);
+  add_child(slot, key[depth], std::make_unique<Leaf>(key, chunk_offset));
+}
+
+void collect_all(const Node& node, std::vector<ChunkOffset>& matches) {
+  if (node.type == NodeType::Leaf) {
+    const auto& chunk_offsets = static_cast<const Leaf&>(node).chunk_offsets;
+    matches.insert(matches.end(), chunk_offsets.cbegin(), chunk_offsets.cend());
+    return;
+  }
+  for_each_child(static_cast<const InnerNode&>(node), [&](const uint8_t, const Node& child) {
+    collect_all(child, matches);
+  });
+}
+
+// compares the bytes of a path in the tree with the same number of leading bytes of a key
+int compare_path(const Key& path, const Key& key) {
+  const auto length = std::min(path.size(), key.size());
+  const auto mismatch = std::mismatch(path.cbegin(), path.cbegin() + length, key.cbegin());
+  if (mismatch.first != path.cbegin() + length) return *mismatch.first < *mismatch.second ? -1 : 1;
+  return path.size() > key.size() ? 1 : 0;
+}
+
+struct RangeBounds {
+  const std::optional<Key>& lower;
+  const bool lower_is_inclusive;
+  const std::optional<Key>& upper;
+  const bool upper_is_inclusive;
+};
+
+// Collects the keys within the bounds from the subtree below `path`. Once a path lies entirely within a bound, the
+// bound is not checked for its subtree anymore.
+void collect_range(const Node& node, Key& path, bool check_lower, bool check_upper, const RangeBounds& bounds,
+                   std::vector<ChunkOffset>& matches) {
+  if (!check_lower && !check_upper) return collect_all(node, matches);
+
+  if (node.type == NodeType::Leaf) {
+    const auto& leaf = static_cast<const Leaf&>(node);
+    if (check_lower && (bounds.lower_is_inclusive ? leaf.key < *bounds.lower : !(*bounds.lower < leaf.key))) return;
+    if (check_upper && (bounds.upper_is_inclusive ? *bounds.upper < leaf.key : !(leaf.key < *bounds.upper))) return;
+    matches.insert(matches.end(), leaf.chunk_offsets.cbegin(), leaf.chunk_offsets.cend());
+    return;
+  }
+
+  const auto& inner_node = static_cast<const InnerNode&>(node);
+  const auto path_size = path.size();
+  path.insert(path.end(), inner_node.prefix.cbegin(), inner_node.prefix.cend());
+
+  auto in_range = true;
+  if (check_lower) {
+    const auto comparison = compare_path(path, *bounds.lower);
+    in_range = comparison >= 0;
+    check_lower = comparison == 0;
+  }
+  if (in_range && check_upper) {
+    const auto comparison = compare_path(path, *bounds.upper);
+    in_range = comparison <= 0;
+    check_upper = comparison == 0;
+  }
+
+  if (in_range) {
+    for_each_child(inner_node, [&](const uint8_t byte, const Node& child) {
+      path.push_back(byte);
+      collect_range(child, path, check_lower, check_upper, bounds, matches);
+      path.pop_back();
+    });
+  }
+  path.resize(path_size);
+}
+
+size_t node_memory_usage(const Node& node) {
+  switch (node.type) {
+    case NodeType::Leaf: {
+      const auto& leaf = static_cast<const Leaf&>(node);
+      return sizeof(Leaf) + leaf.key.capacity() + leaf.chunk_offsets.capacity() * sizeof(ChunkOffset);
+    }
+    case NodeType::Node4:
+      return sizeof(Node4);
+    case NodeType::Node16:
+      return sizeof(Node16);
+    case NodeType::Node48:
+      return sizeof(Node48);
+    case NodeType::Node256:
+      return sizeof(Node256);
+  }
+  Fail("Unknown node type.");
+  return 0;
+}
+
+size_t subtree_memory_usage(const Node& node) {
+  auto memory_usage = node_memory_usage(node);
+  if (node.type == NodeType::Leaf) return memory_usage;
+
+  const auto& inner_node = static_cast<const InnerNode&>(node);
+  memory_usage += inner_node.prefix.capacity();
+  for_each_child(inner_node, [&](const uint8_t, const Node& child) { memory_usage += subtree_memory_usage(child); });
+  return memory_usage;
+}
+
+}  // namespace
+
+AdaptiveRadixTree::AdaptiveRadixTree() = default;
+
+AdaptiveRadixTree::~AdaptiveRadixTree() = default;
+
+AdaptiveRadixTree::AdaptiveRadixTree(AdaptiveRadixTree&&) = default;
+
+AdaptiveRadixTree& AdaptiveRadixTree::operator=(AdaptiveRadixTree&&) = default;
+
+void AdaptiveRadixTree::insert(const Key& key, const ChunkOffset chunk_offset) {
+  insert_into(_root, key, 0, chunk_offset);
+}
+
+void AdaptiveRadixTree::point_lookup(const Key& key, std::vector<ChunkOffset>& matches) const {
+  const auto* node = _root.get();
+  auto depth = size_t{0};
+  while (node) {
+    if (node->type == NodeType::Leaf) {
+      const auto& leaf = static_cast<const Leaf&>(*node);
+      if (leaf.key == key) matches.insert(matches.end(), leaf.chunk_offsets.cbegin(), leaf.chunk_offsets.cend());
+      return;
+    }
+
+    // the prefix is compared here already, so that mismatching keys stop early
+    const auto& inner_node = static_cast<const InnerNode&>(*node);
+    const auto& prefix = inner_node.prefix;
+    if (depth + prefix.size() >= key.size() || !std::equal(prefix.cbegin(), prefix.cend(), key.cbegin() + depth)) {
+      return;
+    }
+    depth += prefix.size();
+    node = find_child(inner_node, key[depth]);
+    ++depth;
+  }
+}
+
+void AdaptiveRadixTree::range_lookup(const std::optional<Key>& lower, const bool lower_is_inclusive,
+                                     const std::optional<Key>& upper, const bool upper_is_inclusive,
+                                     std::vector<ChunkOffset>& matches) const {
+  if (!_root) return;
+  auto path = Key{};
+  collect_range(*_root, path, lower.has_value(), upper.has_value(),
+                RangeBounds{lower, lower_is_inclusive, upper, upper_is_inclusive}, matches);
+}
+
+size_t AdaptiveRadixTree::estimate_memory_usage() const {
+  return sizeof(AdaptiveRadixTree) + (_root ? subtree_memory_usage(*_root) : 0);
+}
+
+template <typename T>
+AdaptiveRadixTreeIndex<T>::AdaptiveRadixTreeIndex(const std::shared_ptr<const BaseSegment>& indexed_segment)
+    : BaseIndex(SegmentIndexType::AdaptiveRadixTree, indexed_segment) {
+  segment_with_iterators<T>(*indexed_segment, [&](auto it, const auto end) {
+    for (; it != end; ++it) {
+      const auto& position = *it;
+      _tree.insert(binary_comparable_key(position.value()), position.chunk_offset());
+    }
+  });
+}
+
+template <typename T>
+AdaptiveRadixTree::Key AdaptiveRadixTreeIndex<T>::binary_comparable_key(const T& value) {
+  auto key = Key{};
+  key.reserve(sizeof(T));
+  append_binary_comparable_key(key, value);
+  return key;
+}
+
+template <typename T>
+void AdaptiveRadixTreeIndex<T>::range_lookup(const IndexBound& lower, const IndexBound& upper,
+                                             std::vector<ChunkOffset>& matches) const {
+  const auto bound_key = [](const IndexBound& bound) -> std::optional<Key> {
+    if (!bound.value) return std::nullopt;
+    return binary_comparable_key(type_cast<T>(*bound.value));
+  };
+  _tree.range_lookup(bound_key(lower), lower.is_inclusive, bound_key(upper), upper.is_inclusive, matches);
+}
+
+template <typename T>
+void AdaptiveRadixTreeIndex<T>::point_lookup(const AllTypeVariant& value, std::vector<ChunkOffset>& matches) const {
+  _tree.point_lookup(binary_comparable_key(type_cast<T>(value)), matches);
+}
+
+template <typename T>
+void AdaptiveRadixTreeIndex<T>::insert(const AllTypeVariant& value, const ChunkOffset chunk_offset) {
+  _tree.insert(binary_comparable_key(type_cast<T>(value)), chunk_offset);
+}
+
+template <typename T>
+size_t AdaptiveRadixTreeIndex<T>::estimate_memory_usage() const {
+  return _tree.estimate_memory_usage();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(AdaptiveRadixTreeIndex);
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_index.hpp"
+#include "binary_comparable_key.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// AdaptiveRadixTree maps byte keys to the chunk offsets of the rows that hold them. Each inner node branches on one
+// byte of the key and grows from 4 over 16 and 48 to 256 children as needed, so that sparse nodes stay small and dense
+// ones can be indexed directly. Bytes that all keys below a node share are stored in the node (path compression), and
+// a leaf is created as soon as a key is the only one with its prefix (lazy expansion).
+//
+// Keys have to be binary-comparable, i.e., their order has to be the lexicographical order of their bytes, and no key
+// may be a prefix of another one.
+class AdaptiveRadixTree : private Noncopyable {
+ public:
+  using Key = BinaryComparableKey;
+
+  // nodes are defined in the translation unit
+  struct Node;
+
+  AdaptiveRadixTree();
+  ~AdaptiveRadixTree();
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  AdaptiveRadixTree(AdaptiveRadixTree&&);
+  AdaptiveRadixTree& operator=(AdaptiveRadixTree&&);
+
+  void insert(const Key& key, const ChunkOffset chunk_offset);
+
+  // appends the chunk offsets stored for the given key
+  void point_lookup(const Key& key, std::vector<ChunkOffset>& matches) const;
+
+  // appends the chunk offsets of all keys between `lower` and `upper` in key order. Missing bounds are unbounded.
+  void range_lookup(const std::optional<Key>& lower, const bool lower_is_inclusive, const std::optional<Key>& upper,
+                    const bool upper_is_inclusive, std::vector<ChunkOffset>& matches) const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+ protected:
+  std::unique_ptr<Node> _root;
+};
+
+// AdaptiveRadixTreeIndex indexes a segment of any encoding with an AdaptiveRadixTree. Unlike the GroupKeyIndex, it
+// does not depend on a dictionary, so it can index ValueSegments, to which it adds rows as they are appended, and
+// dictionary segments whose dictionaries are too large to be searched quickly.
+template <typename T>
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::shared_ptr<const BaseSegment>& indexed_segment);
+
+  // returns the key under which a value is stored, see binary_comparable_key.hpp
+  static AdaptiveRadixTree::Key binary_comparable_key(const T& value);
+
+  void range_lookup(const IndexBound& lower, const IndexBound& upper,
+                    std::vector<ChunkOffset>& matches) const override;
+
+  void point_lookup(const AllTypeVariant& value, std::vector<ChunkOffset>& matches) const override;
+
+  void insert(const AllTypeVariant& value, const ChunkOffset chunk_offset) override;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  AdaptiveRadixTree _tree;
+};
+
+}  // namespace opossum
@@ -0,0 +1,243 @@
+#include "b_plus_tree_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "chunk.hpp"
+#include "resolve_type.hpp"
+#include "segment_iterators.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+struct BPlusTreeIndex::Node {
+  explicit Node(const bool init_is_leaf) : is_leaf(init_is_leaf) {}
+  virtual ~Node() = default;
+
+  const bool is_leaf;
+};
+
+namespace {
+
+using Key = BinaryComparableKey;
+using Node = BPlusTreeIndex::Node;
+
+struct LeafNode : Node {
+  LeafNode() : Node(true) {}
+
+  std::vector<Key> keys;
+  std::vector<RowID> row_ids;
+  LeafNode* next = nullptr;
+};
+
+struct InnerNode : Node {
+  InnerNode() : Node(false) {}
+
+  // separators[i] lies between the keys of children[i] and those of children[i + 1]
+  std::vector<Key> separators;
+  std::vector<std::unique_ptr<Node>> children;
+};
+
+// the smallest key of a node that was split off, which becomes the separator in front of it
+using Split = std::optional<std::pair<Key, std::unique_ptr<Node>>>;
+
+Split insert_into(Node& node, const Key& key, const RowID row_id) {
+  if (node.is_leaf) {
+    auto& leaf = static_cast<LeafNode&>(node);
+    // equal keys are inserted behind the existing ones to keep them in insertion order
+    const auto position = std::upper_bound(leaf.keys.cbegin(), leaf.keys.cend(), key) - leaf.keys.cbegin();
+    leaf.keys.insert(leaf.keys.cbegin() + position, key);
+    leaf.row_ids.insert(leaf.row_ids.cbegin() + position, row_id);
+    if (leaf.keys.size() <= BPlusTreeIndex::node_capacity) return std::nullopt;
+
+    const auto middle = leaf.keys.size() / 2;
+    auto right = std::make_unique<LeafNode>();
+    right->keys.assign(std::make_move_iterator(leaf.keys.begin() + middle), std::make_move_iterator(leaf.keys.end()));
+    right->row_ids.assign(leaf.row_ids.cbegin() + middle, leaf.row_ids.cend());
+    leaf.keys.resize(middle);
+    leaf.row_ids.resize(middle);
+    right->next = leaf.next;
+    leaf.next = right.get();
+    auto separator = right->keys.front();
+    return std::make_pair(std::move(separator), std::unique_ptr<Node>{std::move(right)});
+  }
+
+  auto& inner_node = static_cast<InnerNode&>(node);
+  const auto& separators = inner_node.separators;
+  const auto child_index = std::upper_bound(separators.cbegin(), separators.cend(), key) - separators.cbegin();
+  auto split = insert_into(*inner_node.children[child_index], key, row_id);
+  if (!split) return std::nullopt;
+
+  inner_node.separators.insert(inner_node.separators.cbegin() + child_index, std::move(split->first));
+  inner_node.children.insert(inner_node.children.cbegin() + child_index + 1, std::move(split->second));
+  if (inner_node.children.size() <= BPlusTreeIndex::node_capacity) return std::nullopt;
+
+  // the separator between the two halves moves up to the parent
+  const auto middle = inner_node.children.size() / 2;
+  auto right = std::make_unique<InnerNode>();
+  right->children.assign(std::make_move_iterator(inner_node.children.begin() + middle),
+                         std::make_move_iterator(inner_node.children.end()));
+  right->separators.assign(std::make_move_iterator(inner_node.separators.begin() + middle),
+                           std::make_move_iterator(inner_node.separators.end()));
+  auto separator = std::move(inner_node.separators[middle - 1]);
+  inner_node.children.resize(middle);
+  inner_node.separators.resize(middle - 1);
+  return std::make_pair(std::move(separator), std::unique_ptr<Node>{std::move(right)});
+}
+
+// compares a key with the same number of leading bytes of a bound, which may consist of fewer columns than the key
+int compare_with_bound(const Key& key, const Key& bound) {
+  const auto length = std::min(key.size(), bound.size());
+  const auto mismatch = std::mismatch(key.cbegin(), key.cbegin() + length, bound.cbegin());
+  if (mismatch.first == key.cbegin() + length) return 0;
+  return *mismatch.first < *mismatch.second ? -1 : 1;
+}
+
+// Returns the first leaf entry for which `is_in_range` holds. It has to hold for all following entries as well, so
+// that the leaf can be found by a single descent.
+template <typename Predicate>
+std::pair<const LeafNode*, size_t> find_first(const Node& root, const Predicate& is_in_range) {
+  const auto* node = &root;
+  while (!node->is_leaf) {
+    const auto& inner_node = static_cast<const InnerNode&>(*node);
+    const auto child = std::partition_point(inner_node.separators.cbegin(), inner_node.separators.cend(),
+                                            [&](const Key& separator) { return !is_in_range(separator); });
+    node = inner_node.children[child - inner_node.separators.cbegin()].get();
+  }
+
+  const auto& leaf = static_cast<const LeafNode&>(*node);
+  const auto entry = std::partition_point(leaf.keys.cbegin(), leaf.keys.cend(),
+                                          [&](const Key& key) { return !is_in_range(key); });
+  return {&leaf, entry - leaf.keys.cbegin()};
+}
+
+size_t subtree_memory_usage(const Node& node) {
+  const auto keys_memory_usage = [](const std::vector<Key>& keys) {
+    auto memory_usage = keys.capacity() * sizeof(Key);
+    for (const auto& key : keys) memory_usage += key.capacity();
+    return memory_usage;
+  };
+
+  if (node.is_leaf) {
+    const auto& leaf = static_cast<const LeafNode&>(node);
+    return sizeof(LeafNode) + keys_memory_usage(leaf.keys) + leaf.row_ids.capacity() * sizeof(RowID);
+  }
+
+  const auto& inner_node = static_cast<const InnerNode&>(node);
+  auto memory_usage = sizeof(InnerNode) + keys_memory_usage(inner_node.separators) +
+                      inner_node.children.capacity() * sizeof(std::unique_ptr<Node>);
+  for (const auto& child : inner_node.children) memory_usage += subtree_memory_usage(*child);
+  return memory_usage;
+}
+
+}  // namespace
+
+BPlusTreeIndex::BPlusTreeIndex(std::vector<ColumnID> column_ids, std::vector<std::string> column_types)
+    : _column_ids(std::move(column_ids)), _column_types(std::move(column_types)), _root(std::make_unique<LeafNode>()) {
+  DebugAssert(!_column_ids.empty(), "An index needs at least one column.");
+  DebugAssert(_column_ids.size() == _column_types.size(), "Need exactly one type per indexed column.");
+}
+
+BPlusTreeIndex::~BPlusTreeIndex() = default;
+
+BPlusTreeIndex::BPlusTreeIndex(BPlusTreeIndex&&) = default;
+
+BPlusTreeIndex& BPlusTreeIndex::operator=(BPlusTreeIndex&&) = default;
+
+const std::vector<ColumnID>& BPlusTreeIndex::column_ids() const { return _column_ids; }
+
+void BPlusTreeIndex::insert_chunk(const Chunk& chunk, const ChunkID chunk_id) {
+  // the keys of all rows are built column by column, so that each segment is read sequentially
+  auto keys = std::vector<Key>(chunk.size());
+  for (auto index = size_t{0}; index < _column_ids.size(); ++index) {
+    resolve_data_type(_column_types[index], [&](auto type) {
+      using Type = typename decltype(type)::type;
+      segment_with_iterators<Type>(*chunk.get_segment(_column_ids[index]), [&](auto it, const auto end) {
+        for (; it != end; ++it) {
+          const auto& position = *it;
+          append_binary_comparable_key(keys[position.chunk_offset()], position.value());
+        }
+      });
+    });
+  }
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < keys.size(); ++chunk_offset) {
+    _insert(keys[chunk_offset], RowID{chunk_id, chunk_offset});
+  }
+}
+
+void BPlusTreeIndex::insert(const std::vector<AllTypeVariant>& row, const RowID row_id) {
+  auto values = std::vector<AllTypeVariant>{};
+  values.reserve(_column_ids.size());
+  for (const auto& column_id : _column_ids) values.push_back(row.at(column_id));
+  _insert(_make_key(values), row_id);
+}
+
+std::shared_ptr<PosList> BPlusTreeIndex::point_lookup(const std::vector<AllTypeVariant>& values) const {
+  return range_lookup(values, true, values, true);
+}
+
+std::shared_ptr<PosList> BPlusTreeIndex::range_lookup(const std::vector<AllTypeVariant>& lower,
+                                                      const bool lower_is_inclusive,
+                                                      const std::vector<AllTypeVariant>& upper,
+                                                      const bool upper_is_inclusive) const {
+  const auto lower_key = _make_key(lower);
+  const auto upper_key = _make_key(upper);
+  const auto is_above_lower = [&](const Key& key) {
+    if (lower.empty()) return true;
+    const auto comparison = compare_with_bound(key, lower_key);
+    return lower_is_inclusive ? comparison >= 0 : comparison > 0;
+  };
+  const auto is_below_upper = [&](const Key& key) {
+    if (upper.empty()) return true;
+    const auto comparison = compare_with_bound(key, upper_key);
+    return upper_is_inclusive ? comparison <= 0 : comparison < 0;
+  };
+
+  auto pos_list = std::make_shared<PosList>();
+  auto first = find_first(*_root, is_above_lower);
+  for (const auto* leaf = first.first; leaf; leaf = leaf->next) {
+    for (auto entry = first.second; entry < leaf->keys.size(); ++entry) {
+      if (!is_below_upper(leaf->keys[entry])) return pos_list;
+      pos_list->push_back(leaf->row_ids[entry]);
+    }
+    first.second = 0;
+  }
+  return pos_list;
+}
+
+size_t BPlusTreeIndex::size() const { return _size; }
+
+size_t BPlusTreeIndex::estimate_memory_usage() const { return sizeof(BPlusTreeIndex) + subtree_memory_usage(*_root); }
+
+BinaryComparableKey BPlusTreeIndex::_make_key(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() <= _column_ids.size(), "Got more values than the index has columns.");
+  auto key = Key{};
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    resolve_data_type(_column_types[index], [&](auto type) {
+      using Type = typename decltype(type)::type;
+      append_binary_comparable_key(key, type_cast<Type>(values[index]));
+    });
+  }
+  return key;
+}
+
+void BPlusTreeIndex::_insert(const BinaryComparableKey& key, const RowID row_id) {
+  auto split = insert_into(*_root, key, row_id);
+  ++_size;
+  if (!split) return;
+
+  // the root was split, so the tree grows by one level
+  auto root = std::make_unique<InnerNode>();
+  root->children.push_back(std::move(_root));
+  root->children.push_back(std::move(split->second));
+  root->separators.push_back(std::move(split->first));
+  _root = std::move(root);
+}
+
+}  // namespace opossum
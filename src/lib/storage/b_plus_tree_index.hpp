@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "binary_comparable_key.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// BPlusTreeIndex is a table-level index that maps the values of one or more columns to the RowIDs of all rows that
+// hold them, so that a lookup does not have to probe every chunk. The values of a row are concatenated to a composite
+// binary-comparable key, which orders rows by the first key column, then by the second one, and so on.
+//
+// Leaves hold up to `node_capacity` keys with their RowIDs and are linked to their right neighbor, so that range
+// lookups descend once and then walk along the leaves. Inner nodes hold up to `node_capacity` children. Rows with equal
+// keys are kept in the order they were inserted.
+//
+// Indexes are created and maintained by tables, see Table::create_b_plus_tree_index.
+class BPlusTreeIndex : private Noncopyable {
+ public:
+  static constexpr size_t node_capacity = 64;
+
+  // nodes are defined in the translation unit
+  struct Node;
+
+  BPlusTreeIndex(std::vector<ColumnID> column_ids, std::vector<std::string> column_types);
+  ~BPlusTreeIndex();
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BPlusTreeIndex(BPlusTreeIndex&&);
+  BPlusTreeIndex& operator=(BPlusTreeIndex&&);
+
+  // returns the indexed columns, in the order in which they form the key
+  const std::vector<ColumnID>& column_ids() const;
+
+  // adds all rows of a chunk, which has to hold a segment for each column of the table
+  void insert_chunk(const Chunk& chunk, const ChunkID chunk_id);
+
+  // adds a row, given as the values of all columns of the table
+  void insert(const std::vector<AllTypeVariant>& row, const RowID row_id);
+
+  // Returns the positions of all rows whose key columns hold the given values, ordered by key. If fewer values than key
+  // columns are given, only the leading key columns are compared.
+  std::shared_ptr<PosList> point_lookup(const std::vector<AllTypeVariant>& values) const;
+
+  // Returns the positions of all rows whose key lies between `lower` and `upper`, ordered by key. Like in point_lookup,
+  // bounds with fewer values than key columns are compared with the leading key columns only. An empty bound is
+  // unbounded.
+  std::shared_ptr<PosList> range_lookup(const std::vector<AllTypeVariant>& lower, const bool lower_is_inclusive,
+                                        const std::vector<AllTypeVariant>& upper, const bool upper_is_inclusive) const;
+
+  // returns the number of indexed rows
+  size_t size() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // returns the key of the given values of the leading key columns
+  BinaryComparableKey _make_key(const std::vector<AllTypeVariant>& values) const;
+
+  void _insert(const BinaryComparableKey& key, const RowID row_id);
+
+  std::vector<ColumnID> _column_ids;
+  std::vector<std::string> _column_types;
+  std::unique_ptr<Node> _root;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
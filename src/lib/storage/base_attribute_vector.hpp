@@ -5,7 +5,7 @@
 namespace opossum {
 
 // BaseAttributeVector is the abstract super class for all attribute vectors,
-// e.g., FixedSizeAttributeVector
+// e.g., FixedSizeAttributeVector, BitPackedAttributeVector, SimdBp128AttributeVector
 class BaseAttributeVector : private Noncopyable {
  public:
   BaseAttributeVector() = default;
@@ -22,10 +22,21 @@ class BaseAttributeVector : private Noncopyable {
   // sets the value id at a given position
   virtual void set(const size_t i, const ValueID value_id) = 0;
 
+  // writes `count` value ids starting at position `begin` into `out`. Prefer this over calling get() for every position
+  // - subclasses override it with routines that decode many value ids at once.
+  virtual void decode(const size_t begin, const size_t count, ValueID* out) const {
+    for (auto index = size_t{0}; index < count; ++index) {
+      out[index] = get(begin + index);
+    }
+  }
+
   // returns the number of values
   virtual size_t size() const = 0;
 
   // returns the width of biggest value id in bytes
   virtual AttributeVectorWidth width() const = 0;
+
+  // returns the calculated memory usage
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
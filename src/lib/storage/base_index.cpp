@@ -0,0 +1,56 @@
+#include "base_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseIndex::BaseIndex(const SegmentIndexType type, const std::shared_ptr<const BaseSegment>& indexed_segment)
+    : _type(type), _indexed_segment(indexed_segment) {}
+
+void BaseIndex::point_lookup(const AllTypeVariant& value, std::vector<ChunkOffset>& matches) const {
+  range_lookup(IndexBound{value, true}, IndexBound{value, true}, matches);
+}
+
+void BaseIndex::scan(const ScanType scan_type, const AllTypeVariant& search_value,
+                     std::vector<ChunkOffset>& matches) const {
+  const auto unbounded = IndexBound{std::nullopt, true};
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return point_lookup(search_value, matches);
+    case ScanType::OpNotEquals:
+      range_lookup(unbounded, IndexBound{search_value, false}, matches);
+      return range_lookup(IndexBound{search_value, false}, unbounded, matches);
+    case ScanType::OpLessThan:
+      return range_lookup(unbounded, IndexBound{search_value, false}, matches);
+    case ScanType::OpLessThanEquals:
+      return range_lookup(unbounded, IndexBound{search_value, true}, matches);
+    case ScanType::OpGreaterThan:
+      return range_lookup(IndexBound{search_value, false}, unbounded, matches);
+    case ScanType::OpGreaterThanEquals:
+      return range_lookup(IndexBound{search_value, true}, unbounded, matches);
+    case ScanType::OpBetween:
+      Fail("OpBetween needs an upper search value, use range_lookup.");
+      return;
+  }
+  Fail("Unknown scan type.");
+}
+
+void BaseIndex::insert(const AllTypeVariant& /*value*/, const ChunkOffset /*chunk_offset*/) {
+  Fail("This index does not support inserts.");
+}
+
+bool BaseIndex::supports_range_lookups() const { return true; }
+
+bool BaseIndex::is_index_for(const std::shared_ptr<const BaseSegment>& segment) const {
+  return segment == _indexed_segment;
+}
+
+std::shared_ptr<const BaseSegment> BaseIndex::indexed_segment() const { return _indexed_segment; }
+
+SegmentIndexType BaseIndex::type() const { return _type; }
+
+}  // namespace opossum
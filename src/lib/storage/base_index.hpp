@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+enum class SegmentIndexType : uint8_t { GroupKey, AdaptiveRadixTree, Hash };
+
+// one end of a range of values that is looked up in an index. A bound without a value is unbounded.
+struct IndexBound {
+  std::optional<AllTypeVariant> value;
+  bool is_inclusive = true;
+};
+
+// BaseIndex is the abstract super class for all indexes over a single segment of a chunk. Lookups return the chunk
+// offsets of the matching rows, ordered by their values.
+//
+// Indexes are created and owned by chunks, see Chunk::create_index.
+class BaseIndex : private Noncopyable {
+ public:
+  BaseIndex(const SegmentIndexType type, const std::shared_ptr<const BaseSegment>& indexed_segment);
+  virtual ~BaseIndex() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BaseIndex(BaseIndex&&) = default;
+  BaseIndex& operator=(BaseIndex&&) = default;
+
+  // appends the chunk offsets of all rows whose value lies between `lower` and `upper`
+  virtual void range_lookup(const IndexBound& lower, const IndexBound& upper,
+                            std::vector<ChunkOffset>& matches) const = 0;
+
+  // appends the chunk offsets of all rows whose value equals `value`
+  virtual void point_lookup(const AllTypeVariant& value, std::vector<ChunkOffset>& matches) const;
+
+  // appends the chunk offsets of all rows for which `value <scan_type> search_value` holds
+  void scan(const ScanType scan_type, const AllTypeVariant& search_value, std::vector<ChunkOffset>& matches) const;
+
+  // adds the row that has just been appended to the indexed segment. Indexes over immutable segments do not support it.
+  virtual void insert(const AllTypeVariant& value, const ChunkOffset chunk_offset);
+
+  // returns whether range_lookup is supported, or only point_lookup
+  virtual bool supports_range_lookups() const;
+
+  // returns whether the index was built for the given segment
+  bool is_index_for(const std::shared_ptr<const BaseSegment>& segment) const;
+
+  // returns the segment the index was built for
+  std::shared_ptr<const BaseSegment> indexed_segment() const;
+
+  SegmentIndexType type() const;
+
+  // returns the calculated memory usage
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  SegmentIndexType _type;
+  std::shared_ptr<const BaseSegment> _indexed_segment;
+};
+
+}  // namespace opossum
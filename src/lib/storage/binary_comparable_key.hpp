@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace opossum {
+
+// A binary-comparable key is a byte string whose lexicographical order is the order of the value it was built from.
+// No value's key is a prefix of another value's key, so the keys of several values can be concatenated to a composite
+// key, which orders by the first value, then by the second one, and so on.
+using BinaryComparableKey = std::vector<uint8_t>;
+
+namespace detail {
+
+template <typename UnsignedInteger>
+void append_big_endian(BinaryComparableKey& key, const UnsignedInteger value) {
+  for (auto shift = static_cast<int>(sizeof(UnsignedInteger) * 8) - 8; shift >= 0; shift -= 8) {
+    key.push_back(static_cast<uint8_t>(value >> shift));
+  }
+}
+
+// integers are stored big-endian with a flipped sign bit
+template <typename Integer>
+void append_integral_key(BinaryComparableKey& key, const Integer value) {
+  using Unsigned = std::make_unsigned_t<Integer>;
+  const auto sign_bit = static_cast<Unsigned>(Unsigned{1} << (sizeof(Integer) * 8 - 1));
+  append_big_endian(key, static_cast<Unsigned>(static_cast<Unsigned>(value) ^ sign_bit));
+}
+
+// floating point numbers additionally have all other bits flipped if they are negative
+template <typename FloatingPoint>
+void append_floating_point_key(BinaryComparableKey& key, const FloatingPoint value) {
+  using Unsigned = std::conditional_t<sizeof(FloatingPoint) == sizeof(uint32_t), uint32_t, uint64_t>;
+  const auto sign_bit = static_cast<Unsigned>(Unsigned{1} << (sizeof(FloatingPoint) * 8 - 1));
+  auto bits = Unsigned{0};
+  // -0.0 equals 0.0, so both keep all bits zero
+  if (value != 0) std::memcpy(&bits, &value, sizeof(FloatingPoint));
+  append_big_endian(key, static_cast<Unsigned>((bits & sign_bit) ? ~bits : bits | sign_bit));
+}
+
+// strings end with two zero bytes, and zero bytes within them are followed by 0xFF
+inline void append_string_key(BinaryComparableKey& key, const std::string& value) {
+  for (const auto character : value) {
+    key.push_back(static_cast<uint8_t>(character));
+    if (character == '\0') key.push_back(0xFF);
+  }
+  key.push_back(0x00);
+  key.push_back(0x00);
+}
+
+}  // namespace detail
+
+// appends the binary-comparable key of a value
+template <typename T>
+void append_binary_comparable_key(BinaryComparableKey& key, const T& value) {
+  if constexpr (std::is_integral_v<T>) {
+    detail::append_integral_key(key, value);
+  } else if constexpr (std::is_floating_point_v<T>) {
+    detail::append_floating_point_key(key, value);
+  } else {
+    detail::append_string_key(key, value);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+using DecodeFunction = void (*)(const uint64_t*, const size_t, const size_t, ValueID*);
+
+// The bit width is a template parameter so that the compiler can turn the mask and the shifts into constants.
+template <uint8_t bit_width>
+void decode_with_bit_width(const uint64_t* words, const size_t begin, const size_t count, ValueID* out) {
+  constexpr auto mask = (uint64_t{1} << bit_width) - 1;
+  auto bit_position = begin * bit_width;
+
+  for (auto index = size_t{0}; index < count; ++index) {
+    const auto word_index = bit_position >> 6;
+    const auto shift = bit_position & 63;
+    // shifting by (64 - shift) would be undefined for shift == 0, so we split the shift in two
+    const auto low = words[word_index] >> shift;
+    const auto high = (words[word_index + 1] << 1) << (63 - shift);
+    out[index] = ValueID{static_cast<ValueID::base_type>((low | high) & mask)};
+    bit_position += bit_width;
+  }
+}
+
+template <size_t... bit_width_indices>
+constexpr std::array<DecodeFunction, sizeof...(bit_width_indices)> make_decode_functions(
+    std::index_sequence<bit_width_indices...>) {
+  return {{&decode_with_bit_width<static_cast<uint8_t>(bit_width_indices + 1)>...}};
+}
+
+// decode_functions[n] handles a bit width of n + 1
+constexpr auto decode_functions = make_decode_functions(std::make_index_sequence<32>{});
+
+}  // namespace
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width)
+    : _size(size), _bit_width(bit_width), _mask((uint64_t{1} << bit_width) - 1) {
+  Assert(bit_width >= 1 && bit_width <= 32, "Bit width has to be between 1 and 32.");
+  _words.resize((size * bit_width + 63) / 64 + 1);
+}
+
+uint8_t BitPackedAttributeVector::required_bit_width(const ValueID max_value_id) {
+  auto bit_width = uint8_t{1};
+  while (bit_width < 32 && (ValueID::base_type{max_value_id} >> bit_width) != 0) {
+    ++bit_width;
+  }
+  return bit_width;
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "Position is out of range.");
+  const auto bit_position = i * _bit_width;
+  const auto word_index = bit_position >> 6;
+  const auto shift = bit_position & 63;
+  const auto low = _words[word_index] >> shift;
+  const auto high = (_words[word_index + 1] << 1) << (63 - shift);
+  return ValueID{static_cast<ValueID::base_type>((low | high) & _mask)};
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  DebugAssert(i < _size, "Position is out of range.");
+  const auto value = static_cast<uint64_t>(value_id);
+  DebugAssert(value <= _mask, "Value id does not fit into the bit width.");
+  const auto bit_position = i * _bit_width;
+  const auto word_index = bit_position >> 6;
+  const auto shift = bit_position & 63;
+
+  _words[word_index] = (_words[word_index] & ~(_mask << shift)) | (value << shift);
+
+  // the value spans two words, so its upper bits go into the next one
+  if (shift + _bit_width > 64) {
+    const auto stored_bits = 64 - shift;
+    _words[word_index + 1] = (_words[word_index + 1] & ~(_mask >> stored_bits)) | (value >> stored_bits);
+  }
+}
+
+void BitPackedAttributeVector::decode(const size_t begin, const size_t count, ValueID* out) const {
+  DebugAssert(begin + count <= _size, "Range is out of bounds.");
+  decode_functions[_bit_width - 1](_words.data(), begin, count, out);
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const { return (_bit_width + 7) / 8; }
+
+uint8_t BitPackedAttributeVector::bit_width() const { return _bit_width; }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const { return _words.size() * sizeof(uint64_t); }
+
+}  // namespace opossum
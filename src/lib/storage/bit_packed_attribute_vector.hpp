@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BitPackedAttributeVector stores each value id with exactly `bit_width` bits (1 to 32), consecutively packed into
+// 64-bit words. A value id may span two words. One additional word is always allocated at the end so that reading
+// the second word of a value never needs a bounds check.
+//
+// The vector is created with its final size and set() overwrites in place.
+class BitPackedAttributeVector final : public BaseAttributeVector {
+ public:
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width);
+  ~BitPackedAttributeVector() override = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BitPackedAttributeVector(BitPackedAttributeVector&&) = default;
+  BitPackedAttributeVector& operator=(BitPackedAttributeVector&&) = default;
+
+  // returns the number of bits needed to store the given value id, but at least 1
+  static uint8_t required_bit_width(const ValueID max_value_id);
+
+  // returns the value id at a given position
+  ValueID get(const size_t i) const override;
+
+  // sets the value id at a given position
+  void set(const size_t i, const ValueID value_id) override;
+
+  // unpacks `count` value ids starting at position `begin` into `out`. This is considerably faster than calling get()
+  // for each position, because the loop is specialized for the bit width and does not go through a virtual call.
+  void decode(const size_t begin, const size_t count, ValueID* out) const override;
+
+  // returns the number of values
+  size_t size() const override;
+
+  // returns the width of biggest value id in bytes, rounded up
+  AttributeVectorWidth width() const override;
+
+  // returns the number of bits used per value id
+  uint8_t bit_width() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  size_t _size;
+  uint8_t _bit_width;
+  uint64_t _mask;
+  std::vector<uint64_t> _words;
+};
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// blocked filters have a slightly higher false-positive rate than classic ones, this many more bits make up for it
+constexpr double blocked_filter_bit_overhead = 1.1;
+
+constexpr uint8_t max_hash_function_count = 16;
+
+}  // namespace
+
+BloomFilter::BloomFilter(const size_t element_count, const double false_positive_rate) {
+  Assert(false_positive_rate > 0.0 && false_positive_rate < 1.0, "False-positive rate has to be in (0, 1).");
+
+  // the optimal number of bits per value is -ln(p) / ln(2)^2, with ln(2) * bits per value hash functions
+  const auto ln_2 = std::log(2.0);
+  const auto bits_per_element = -std::log(false_positive_rate) / (ln_2 * ln_2);
+  const auto hash_function_count = static_cast<int64_t>(std::lround(bits_per_element * ln_2));
+  _hash_function_count =
+      static_cast<uint8_t>(std::clamp(hash_function_count, int64_t{1}, int64_t{max_hash_function_count}));
+
+  const auto bit_count = std::ceil(static_cast<double>(element_count) * bits_per_element * blocked_filter_bit_overhead);
+  const auto block_count = std::max(size_t{1}, static_cast<size_t>(std::ceil(bit_count / block_bit_count)));
+  _blocks.resize(block_count);
+}
+
+void BloomFilter::insert_hash(const uint64_t hash) {
+  // the upper half of the hash selects the block, the lower half and a second hash derived from it select the bits
+  auto& block = _blocks[((hash >> 32) * _blocks.size()) >> 32];
+  const auto step = static_cast<uint32_t>(_mix(hash)) | 1u;
+  auto bit = static_cast<uint32_t>(hash);
+  for (auto hash_function = uint8_t{0}; hash_function < _hash_function_count; ++hash_function) {
+    const auto bit_in_block = bit % block_bit_count;
+    block[bit_in_block / 64] |= uint64_t{1} << (bit_in_block % 64);
+    bit += step;
+  }
+}
+
+bool BloomFilter::may_contain_hash(const uint64_t hash) const {
+  const auto& block = _blocks[((hash >> 32) * _blocks.size()) >> 32];
+  const auto step = static_cast<uint32_t>(_mix(hash)) | 1u;
+  auto bit = static_cast<uint32_t>(hash);
+  for (auto hash_function = uint8_t{0}; hash_function < _hash_function_count; ++hash_function) {
+    const auto bit_in_block = bit % block_bit_count;
+    if (!(block[bit_in_block / 64] & (uint64_t{1} << (bit_in_block % 64)))) return false;
+    bit += step;
+  }
+  return true;
+}
+
+uint8_t BloomFilter::hash_function_count() const { return _hash_function_count; }
+
+size_t BloomFilter::block_count() const { return _blocks.size(); }
+
+size_t BloomFilter::estimate_memory_usage() const { return _blocks.size() * sizeof(Block); }
+
+uint64_t BloomFilter::_mix(uint64_t hash) {
+  // the finalizer of MurmurHash3
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb3f99fa1f2c9ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+}  // namespace opossum
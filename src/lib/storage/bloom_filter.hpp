@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// BloomFilter is a blocked Bloom filter over the values of a segment. It answers whether a value may be contained in
+// the segment: a negative answer is always correct, a positive one is wrong with roughly the configured false-positive
+// rate.
+//
+// All bits of a value are set within a single block of 512 bits, i.e., one cache line, so that a lookup touches only
+// one cache line regardless of the number of hash functions. Compared to a classic Bloom filter of the same size, this
+// raises the false-positive rate slightly, which is why the filter is sized with a small safety margin.
+class BloomFilter : private Noncopyable {
+ public:
+  static constexpr double default_false_positive_rate = 0.01;
+  static constexpr size_t block_bit_count = 512;
+
+  // creates an empty filter that is sized for `element_count` distinct values and the given false-positive rate
+  explicit BloomFilter(const size_t element_count, const double false_positive_rate = default_false_positive_rate);
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BloomFilter(BloomFilter&&) = default;
+  BloomFilter& operator=(BloomFilter&&) = default;
+
+  // adds a value to the filter
+  template <typename T>
+  void insert(const T& value) {
+    insert_hash(hash(value));
+  }
+
+  // returns false if the value is certainly not contained in the filter
+  template <typename T>
+  bool may_contain(const T& value) const {
+    return may_contain_hash(hash(value));
+  }
+
+  // same as insert and may_contain, for values that have already been hashed with hash()
+  void insert_hash(const uint64_t hash);
+  bool may_contain_hash(const uint64_t hash) const;
+
+  // returns a well-mixed 64-bit hash of the value. std::hash is the identity for integers in some standard libraries,
+  // so its result is mixed once more.
+  template <typename T>
+  static uint64_t hash(const T& value) {
+    return _mix(static_cast<uint64_t>(std::hash<T>{}(value)));
+  }
+
+  // returns the number of bits that are set per value
+  uint8_t hash_function_count() const;
+
+  // returns the number of 512-bit blocks
+  size_t block_count() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+ protected:
+  using Block = std::array<uint64_t, block_bit_count / 64>;
+
+  static uint64_t _mix(uint64_t hash);
+
+  uint8_t _hash_function_count;
+  std::vector<Block> _blocks;
+};
+
+}  // namespace opossum
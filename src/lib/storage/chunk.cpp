@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <iterator>
 #include <limits>
@@ -9,6 +11,7 @@
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "segment_statistics.hpp"
 
 #include "utils/assert.hpp"
 
@@ -22,6 +25,9 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   for (ColumnID current_column_id{0}; current_column_id < column_count(); current_column_id++) {
     _segments[current_column_id]->append(values[current_column_id]);
   }
+
+  const auto chunk_offset = static_cast<ChunkOffset>(size() - 1);
+  for (const auto& entry : _indexes) entry.second->insert(values[entry.first], chunk_offset);
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
@@ -29,6 +35,73 @@ std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
   return _segments[column_id];
 }
 
+void Chunk::replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment) {
+  DebugAssert(column_id < _segments.size(), "No segment exists for the given column_id.");
+  DebugAssert(segment->size() == _segments[column_id]->size(), "The new segment has to have the same size.");
+  _segments[column_id] = std::move(segment);
+  _indexes.erase(std::remove_if(_indexes.begin(), _indexes.end(),
+                                [&](const auto& entry) { return entry.first == column_id; }),
+                 _indexes.end());
+}
+
+void Chunk::set_statistics(ColumnID column_id, std::shared_ptr<const BaseSegmentStatistics> statistics) {
+  DebugAssert(column_id < _segments.size(), "No segment exists for the given column_id.");
+  if (_statistics.size() < _segments.size()) _statistics.resize(_segments.size());
+  _statistics[column_id] = std::move(statistics);
+}
+
+std::shared_ptr<const BaseSegmentStatistics> Chunk::get_statistics(ColumnID column_id) const {
+  DebugAssert(column_id < _segments.size(), "No segment exists for the given column_id.");
+  return column_id < _statistics.size() ? _statistics[column_id] : nullptr;
+}
+
+void Chunk::set_sorted_by(ColumnID column_id) {
+  DebugAssert(column_id < _segments.size(), "No segment exists for the given column_id.");
+  if (!is_sorted_by(column_id)) _sorted_by.push_back(column_id);
+}
+
+bool Chunk::is_sorted_by(ColumnID column_id) const {
+  return std::find(_sorted_by.cbegin(), _sorted_by.cend(), column_id) != _sorted_by.cend();
+}
+
+const std::vector<ColumnID>& Chunk::sorted_by() const { return _sorted_by; }
+
+std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indexes(ColumnID column_id) const {
+  auto indexes = std::vector<std::shared_ptr<BaseIndex>>{};
+  for (const auto& entry : _indexes) {
+    if (entry.first == column_id) indexes.push_back(entry.second);
+  }
+  return indexes;
+}
+
+std::shared_ptr<BaseIndex> Chunk::get_index(ColumnID column_id, SegmentIndexType type) const {
+  for (const auto& entry : _indexes) {
+    if (entry.first == column_id && entry.second->type() == type) return entry.second;
+  }
+  return nullptr;
+}
+
+void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
+  _indexes.erase(std::remove_if(_indexes.begin(), _indexes.end(),
+                                [&](const auto& entry) { return entry.second == index; }),
+                 _indexes.end());
+}
+
+size_t Chunk::estimate_index_memory_usage() const {
+  auto memory_usage = size_t{0};
+  for (const auto& entry : _indexes) memory_usage += entry.second->estimate_memory_usage();
+  return memory_usage;
+}
+
+void Chunk::mark_accessed() const {
+  _last_access->store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+std::chrono::steady_clock::time_point Chunk::last_access() const {
+  return std::chrono::steady_clock::time_point{
+      std::chrono::steady_clock::duration{_last_access->load(std::memory_order_relaxed)}};
+}
+
 uint16_t Chunk::column_count() const { return _segments.size(); }
 
 uint32_t Chunk::size() const { return _segments.empty() ? 0u : _segments[0]->size(); }
@@ -4,17 +4,20 @@
 #include <shared_mutex>
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "base_index.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
-class BaseIndex;
 class BaseSegment;
+class BaseSegmentStatistics;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
@@ -38,15 +41,68 @@ class Chunk : private Noncopyable {
   // returns the number of rows (cannot exceed ChunkOffset (uint32_t))
   uint32_t size() const;
 
-  // adds a new row, given as a list of values, to the chunk
+  // adds a new row, given as a list of values, to the chunk and to its indexes
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // replaces the segment at a given position with one of the same size, e.g., a differently encoded one. Indexes on
+  // the replaced segment are dropped.
+  void replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment);
+
+  // sets the statistics of the segment at a given position, which Table::compress_chunk computes
+  void set_statistics(ColumnID column_id, std::shared_ptr<const BaseSegmentStatistics> statistics);
+
+  // returns the statistics of the segment at a given position, or nullptr if none have been computed
+  std::shared_ptr<const BaseSegmentStatistics> get_statistics(ColumnID column_id) const;
+
+  // records that the values of the segment at a given position are sorted in ascending order, which lets scans use
+  // binary search. Table::compress_chunk detects this, steps that reorganize a chunk have to set it themselves.
+  void set_sorted_by(ColumnID column_id);
+
+  // returns whether the values of the segment at a given position are known to be sorted in ascending order
+  bool is_sorted_by(ColumnID column_id) const;
+
+  // returns all columns whose segments are known to be sorted in ascending order
+  const std::vector<ColumnID>& sorted_by() const;
+
+  // Creates an index of the given type on the segment at a given position and keeps it with the chunk. Indexes belong
+  // to the segment they were built on, so Table::compress_chunk, which replaces the chunk, drops them.
+  template <typename Index>
+  std::shared_ptr<Index> create_index(ColumnID column_id) {
+    auto index = std::make_shared<Index>(get_segment(column_id));
+    _indexes.emplace_back(column_id, index);
+    return index;
+  }
+
+  // returns all indexes on the segment at a given position
+  std::vector<std::shared_ptr<BaseIndex>> get_indexes(ColumnID column_id) const;
+
+  // returns an index of the given type on the segment at a given position, or nullptr if there is none
+  std::shared_ptr<BaseIndex> get_index(ColumnID column_id, SegmentIndexType type) const;
+
+  // removes the given index from the chunk
+  void remove_index(const std::shared_ptr<BaseIndex>& index);
+
+  // returns the calculated memory usage of all indexes of the chunk
+  size_t estimate_index_memory_usage() const;
+
+  // records that the chunk has been scanned, which keeps Table::demote_cold_chunks from demoting it for a while
+  void mark_accessed() const;
+
+  // returns when the chunk was last scanned, or created if it has not been scanned yet
+  std::chrono::steady_clock::time_point last_access() const;
+
  protected:
   std::vector<std::shared_ptr<BaseSegment>> _segments;
+  std::vector<std::shared_ptr<const BaseSegmentStatistics>> _statistics;
+  std::vector<ColumnID> _sorted_by;
+  std::vector<std::pair<ColumnID, std::shared_ptr<BaseIndex>>> _indexes;
+  std::unique_ptr<std::atomic<std::chrono::steady_clock::rep>> _last_access =
+      std::make_unique<std::atomic<std::chrono::steady_clock::rep>>(
+          std::chrono::steady_clock::now().time_since_epoch().count());
 };
 
 }  // namespace opossum
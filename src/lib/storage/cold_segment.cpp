@@ -0,0 +1,131 @@
+#include "cold_segment.hpp"
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "segment_encoding_utils.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/lz_compression.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Numbers are serialized as their raw bytes, strings as their varint-encoded length followed by their characters.
+template <typename T>
+void serialize_value(std::vector<char>& buffer, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto length = value.size();
+    while (length >= 0x80) {
+      buffer.push_back(static_cast<char>((length & 0x7F) | 0x80));
+      length >>= 7;
+    }
+    buffer.push_back(static_cast<char>(length));
+    buffer.insert(buffer.end(), value.cbegin(), value.cend());
+  } else {
+    const auto* bytes = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+  }
+}
+
+// reads a value and advances `position` behind it
+template <typename T>
+T deserialize_value(const char*& position) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto length = size_t{0};
+    for (auto shift = 0;; shift += 7) {
+      const auto byte = static_cast<uint8_t>(*position++);
+      length |= static_cast<size_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) break;
+    }
+    auto value = std::string{position, length};
+    position += length;
+    return value;
+  } else {
+    auto value = T{};
+    std::memcpy(&value, position, sizeof(T));
+    position += sizeof(T);
+    return value;
+  }
+}
+
+}  // namespace
+
+ColdSegment::ColdSegment(const std::string& type, const std::shared_ptr<const BaseSegment>& segment)
+    : _type(type), _encoding_spec(encoding_spec_of(type, segment)), _size(segment->size()) {
+  Assert(!std::dynamic_pointer_cast<const ColdSegment>(segment), "Segment is already cold.");
+
+  auto buffer = std::vector<char>{};
+  resolve_data_type(type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<Type>>(segment)) {
+      for (const auto& value : value_segment->values()) serialize_value(buffer, value);
+    } else {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+        serialize_value(buffer, type_cast<Type>((*segment)[chunk_offset]));
+      }
+    }
+  });
+
+  _compressed_values = lz_compress(buffer.data(), buffer.size());
+}
+
+AllTypeVariant ColdSegment::operator[](const ChunkOffset chunk_offset) const { return (*segment())[chunk_offset]; }
+
+void ColdSegment::append(const AllTypeVariant&) { throw std::runtime_error("Cold segments are immutable."); }
+
+std::shared_ptr<BaseSegment> ColdSegment::segment() const {
+  std::lock_guard<std::mutex> lock_guard(*_segment_mutex);
+  if (_segment) return _segment;
+
+  const auto buffer = lz_decompress(_compressed_values);
+  auto value_segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    auto values = std::vector<Type>{};
+    values.reserve(_size);
+    const auto* position = buffer.data();
+    for (auto chunk_offset = size_t{0}; chunk_offset < _size; ++chunk_offset) {
+      values.push_back(deserialize_value<Type>(position));
+    }
+    DebugAssert(position == buffer.data() + buffer.size(), "Decompressed values have an unexpected size.");
+    value_segment = std::make_shared<ValueSegment<Type>>(std::move(values));
+  });
+
+  _segment = _encoding_spec ? encode_segment(_type, value_segment, *_encoding_spec) : value_segment;
+  return _segment;
+}
+
+bool ColdSegment::is_decompressed() const {
+  std::lock_guard<std::mutex> lock_guard(*_segment_mutex);
+  return static_cast<bool>(_segment);
+}
+
+void ColdSegment::evict() {
+  std::lock_guard<std::mutex> lock_guard(*_segment_mutex);
+  _segment = nullptr;
+}
+
+const std::string& ColdSegment::type() const { return _type; }
+
+const std::optional<SegmentEncodingSpec>& ColdSegment::encoding_spec() const { return _encoding_spec; }
+
+size_t ColdSegment::compressed_size() const { return _compressed_values.size(); }
+
+size_t ColdSegment::size() const { return _size; }
+
+size_t ColdSegment::estimate_memory_usage() const {
+  std::lock_guard<std::mutex> lock_guard(*_segment_mutex);
+  return _compressed_values.size() + (_segment ? _segment->estimate_memory_usage() : 0);
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// ColdSegment keeps the values of a rarely accessed segment compressed with lz_compress. On first access, the values
+// are decompressed and the original segment is rebuilt with the encoding it had before, which is then kept until
+// evict() is called. Table::demote_cold_chunks turns the segments of chunks that have not been scanned for a while
+// into ColdSegments.
+class ColdSegment : public BaseSegment {
+ public:
+  // compresses the values of a segment of the given data type, which may be a ValueSegment or an encoded segment
+  ColdSegment(const std::string& type, const std::shared_ptr<const BaseSegment>& segment);
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  ColdSegment(ColdSegment&&) = default;
+  ColdSegment& operator=(ColdSegment&&) = default;
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // cold segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // returns the rebuilt segment, decompressing it if it is not in memory
+  std::shared_ptr<BaseSegment> segment() const;
+
+  // returns whether the rebuilt segment is currently held in memory
+  bool is_decompressed() const;
+
+  // releases the rebuilt segment, so that only the compressed values remain in memory. Callers that still hold the
+  // segment keep it alive.
+  void evict();
+
+  // returns the data type of the segment
+  const std::string& type() const;
+
+  // returns the encoding the segment is rebuilt with, std::nullopt stands for a ValueSegment
+  const std::optional<SegmentEncodingSpec>& encoding_spec() const;
+
+  // returns the size of the compressed values in bytes
+  size_t compressed_size() const;
+
+  // return the number of entries
+  size_t size() const override;
+
+  // returns the calculated memory usage, including the rebuilt segment if it is in memory
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::string _type;
+  std::optional<SegmentEncodingSpec> _encoding_spec;
+  size_t _size;
+  std::vector<char> _compressed_values;
+  mutable std::shared_ptr<BaseSegment> _segment;
+  std::unique_ptr<std::mutex> _segment_mutex = std::make_unique<std::mutex>();
+};
+
+}  // namespace opossum
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/scan_type_utils.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// DeltaSegment is a specific segment type for int and long columns whose values grow (almost) monotonically, such as
+// insertion timestamps or auto-increment ids. The values are split into blocks. The first value of each block (its
+// anchor) is stored in full, all following values as the delta to their predecessor. Within a block, the deltas are
+// stored as bit-packed offsets to the block's smallest delta, with a bit width chosen per block. A column with a
+// constant stride, e.g., 1, 2, 3, ..., needs no bits per value at all.
+//
+// Accessing a value decodes at most one block. If the values are sorted, scans binary-search the anchors and then
+// decode only the block in which the matching range begins or ends.
+template <typename T>
+class DeltaSegment : public BaseSegment {
+  static_assert(std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>,
+                "DeltaSegment only supports int and long columns.");
+
+  // all arithmetic on deltas is done modulo 2^n, so that deltas between extreme values cannot overflow
+  using UnsignedT = std::make_unsigned_t<T>;
+
+ public:
+  static constexpr ChunkOffset block_size = 128;
+
+  /**
+   * Creates a Delta segment from a given value segment.
+   */
+  explicit DeltaSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+    const auto value_segment = std::static_pointer_cast<ValueSegment<T>>(base_segment);
+    const auto& values = value_segment->values();
+
+    _size = values.size();
+    _is_sorted = std::is_sorted(values.cbegin(), values.cend());
+
+    const auto block_count = (values.size() + block_size - 1) / block_size;
+    _anchors.reserve(block_count);
+    _min_deltas.reserve(block_count);
+    _bit_widths.reserve(block_count);
+    _block_word_offsets.reserve(block_count);
+
+    for (auto block_begin = size_t{0}; block_begin < values.size(); block_begin += block_size) {
+      const auto block_end = std::min(block_begin + block_size, values.size());
+
+      // the deltas are interpreted as signed values, so that the smallest delta of a near-sorted block is negative
+      // instead of wrapping around to a huge offset
+      auto min_delta = std::numeric_limits<T>::max();
+      auto max_delta = std::numeric_limits<T>::min();
+      for (auto position = block_begin + 1; position < block_end; ++position) {
+        const auto delta = _delta(values[position - 1], values[position]);
+        min_delta = std::min(min_delta, delta);
+        max_delta = std::max(max_delta, delta);
+      }
+      if (block_end - block_begin == 1) {
+        min_delta = 0;
+        max_delta = 0;
+      }
+
+      const auto max_offset =
+          static_cast<UnsignedT>(static_cast<UnsignedT>(max_delta) - static_cast<UnsignedT>(min_delta));
+      auto bit_width = uint8_t{0};
+      while (bit_width < sizeof(UnsignedT) * 8 && (max_offset >> bit_width) != 0) ++bit_width;
+
+      _anchors.push_back(values[block_begin]);
+      _min_deltas.push_back(min_delta);
+      _bit_widths.push_back(bit_width);
+      _block_word_offsets.push_back(static_cast<uint32_t>(_words.size()));
+
+      // each block starts at a word boundary
+      const auto block_bit_count = (block_end - block_begin - 1) * bit_width;
+      auto bit_position = _words.size() * 64;
+      _words.resize(_words.size() + (block_bit_count + 63) / 64);
+      for (auto position = block_begin + 1; position < block_end; ++position) {
+        const auto delta = _delta(values[position - 1], values[position]);
+        _write_bits(bit_position, bit_width, static_cast<UnsignedT>(delta) - static_cast<UnsignedT>(min_delta));
+        bit_position += bit_width;
+      }
+    }
+
+    // reading a value that spans two words touches the word after the last block
+    _words.push_back(0);
+  }
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override { return get(chunk_offset); }
+
+  // return the value at a certain position.
+  T get(const ChunkOffset chunk_offset) const {
+    DebugAssert(chunk_offset < _size, "Chunk offset is out of range.");
+    const auto block_index = chunk_offset / block_size;
+    const auto bit_width = _bit_widths[block_index];
+    const auto delta_count = chunk_offset % block_size;
+
+    // the min deltas are added all at once, only the offsets have to be summed up
+    auto value = static_cast<UnsignedT>(static_cast<UnsignedT>(_anchors[block_index]) +
+                                        static_cast<UnsignedT>(_min_deltas[block_index]) * delta_count);
+    auto bit_position = size_t{_block_word_offsets[block_index]} * 64;
+    for (auto delta_index = ChunkOffset{0}; delta_index < delta_count; ++delta_index) {
+      value += _read_bits(bit_position, bit_width);
+      bit_position += bit_width;
+    }
+    return static_cast<T>(value);
+  }
+
+  // delta segments are immutable
+  void append(const AllTypeVariant&) override { throw std::runtime_error("Delta segments are immutable."); }
+
+  // writes all values of the given block into `out`, which has to have room for block_size values
+  void decode_block(const size_t block_index, T* out) const {
+    DebugAssert(block_index < _anchors.size(), "Block index is out of range.");
+    const auto block_end = std::min((block_index + 1) * block_size, _size);
+    const auto bit_width = _bit_widths[block_index];
+    const auto min_delta = static_cast<UnsignedT>(_min_deltas[block_index]);
+
+    auto value = static_cast<UnsignedT>(_anchors[block_index]);
+    auto bit_position = size_t{_block_word_offsets[block_index]} * 64;
+    out[0] = static_cast<T>(value);
+    for (auto position = block_index * block_size + 1; position < block_end; ++position) {
+      value += min_delta + _read_bits(bit_position, bit_width);
+      bit_position += bit_width;
+      *(++out) = static_cast<T>(value);
+    }
+  }
+
+  // appends the chunk offsets of all values v for which `v <scan_type> search_value` holds to `matches`.
+  // If the segment is sorted, the matches form at most two ranges whose bounds are found by binary search.
+  void scan(const ScanType scan_type, const T search_value, std::vector<ChunkOffset>& matches) const {
+    if (!_is_sorted) {
+      auto block_values = std::array<T, block_size>{};
+      with_comparator(scan_type, [&](auto comparator) {
+        for (auto block_index = size_t{0}; block_index < _anchors.size(); ++block_index) {
+          decode_block(block_index, block_values.data());
+          const auto block_begin = static_cast<ChunkOffset>(block_index * block_size);
+          const auto block_length = static_cast<ChunkOffset>(std::min(size_t{block_size}, _size - block_begin));
+          for (auto index = ChunkOffset{0}; index < block_length; ++index) {
+            if (comparator(block_values[index], search_value)) matches.push_back(block_begin + index);
+          }
+        }
+      });
+      return;
+    }
+
+    const auto append_range = [&](const ChunkOffset begin, const ChunkOffset end) {
+      for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) matches.push_back(chunk_offset);
+    };
+
+    const auto size = static_cast<ChunkOffset>(_size);
+    const auto lower = lower_bound(search_value);
+    const auto upper = upper_bound(search_value);
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return append_range(lower, upper);
+      case ScanType::OpNotEquals:
+        append_range(0, lower);
+        return append_range(upper, size);
+      case ScanType::OpLessThan:
+        return append_range(0, lower);
+      case ScanType::OpLessThanEquals:
+        return append_range(0, upper);
+      case ScanType::OpGreaterThan:
+        return append_range(upper, size);
+      case ScanType::OpGreaterThanEquals:
+        return append_range(lower, size);
+      case ScanType::OpBetween:
+        Fail("OpBetween needs an upper search value.");
+        return;
+    }
+    Fail("Unknown scan type.");
+  }
+
+  // returns the first position whose value is >= value, or size() if there is none. Requires a sorted segment.
+  ChunkOffset lower_bound(const T value) const {
+    return _partition_point([&](const T candidate) { return candidate >= value; });
+  }
+
+  // returns the first position whose value is > value, or size() if there is none. Requires a sorted segment.
+  ChunkOffset upper_bound(const T value) const {
+    return _partition_point([&](const T candidate) { return candidate > value; });
+  }
+
+  // returns whether the values are sorted in ascending order, which enables binary search
+  bool is_sorted() const { return _is_sorted; }
+
+  // returns the number of blocks
+  size_t block_count() const { return _anchors.size(); }
+
+  // returns the first value of each block
+  const std::vector<T>& anchors() const { return _anchors; }
+
+  // returns the number of bits used per delta in each block
+  const std::vector<uint8_t>& bit_widths() const { return _bit_widths; }
+
+  // return the number of entries
+  size_t size() const override { return _size; }
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final {
+    return _anchors.size() * (2 * sizeof(T) + sizeof(uint8_t) + sizeof(uint32_t)) + _words.size() * sizeof(uint64_t);
+  }
+
+ protected:
+  // returns next - previous, wrapped into T
+  static T _delta(const T previous, const T next) {
+    return static_cast<T>(static_cast<UnsignedT>(static_cast<UnsignedT>(next) - static_cast<UnsignedT>(previous)));
+  }
+
+  UnsignedT _read_bits(const size_t bit_position, const uint8_t bit_width) const {
+    if (bit_width == 0) return 0;
+    const auto word_index = bit_position / 64;
+    const auto shift = bit_position % 64;
+    auto bits = _words[word_index] >> shift;
+    if (shift + bit_width > 64) bits |= _words[word_index + 1] << (64 - shift);
+    const auto mask = bit_width == 64 ? ~uint64_t{0} : (uint64_t{1} << bit_width) - 1;
+    return static_cast<UnsignedT>(bits & mask);
+  }
+
+  void _write_bits(const size_t bit_position, const uint8_t bit_width, const uint64_t bits) {
+    if (bit_width == 0) return;
+    const auto word_index = bit_position / 64;
+    const auto shift = bit_position % 64;
+    _words[word_index] |= bits << shift;
+    if (shift + bit_width > 64) _words[word_index + 1] |= bits >> (64 - shift);
+  }
+
+  // returns the first position for which `is_match` holds, assuming that it holds for all following positions as well
+  template <typename Predicate>
+  ChunkOffset _partition_point(const Predicate& is_match) const {
+    DebugAssert(_is_sorted, "Binary search requires a sorted segment.");
+
+    // the first block whose anchor matches, the match we are looking for is either its anchor or in the block before
+    const auto first_matching_block = static_cast<size_t>(
+        std::partition_point(_anchors.cbegin(), _anchors.cend(), [&](const T anchor) { return !is_match(anchor); }) -
+        _anchors.cbegin());
+    if (first_matching_block == 0) return 0;
+
+    const auto block_index = first_matching_block - 1;
+    const auto block_begin = block_index * block_size;
+    const auto block_length = std::min(size_t{block_size}, _size - block_begin);
+    auto block_values = std::array<T, block_size>{};
+    decode_block(block_index, block_values.data());
+    const auto match = std::partition_point(block_values.cbegin(), block_values.cbegin() + block_length,
+                                            [&](const T value) { return !is_match(value); });
+    return static_cast<ChunkOffset>(block_begin + (match - block_values.cbegin()));
+  }
+
+  size_t _size = 0;
+  bool _is_sorted = true;
+  std::vector<T> _anchors;
+  std::vector<T> _min_deltas;
+  std::vector<uint8_t> _bit_widths;
+  std::vector<uint32_t> _block_word_offsets;
+  std::vector<uint64_t> _words;
+};
+
+}  // namespace opossum
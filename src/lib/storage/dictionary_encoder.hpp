@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "encoding_type.hpp"
+#include "fixed_size_attribute_vector.hpp"
+#include "simd_bp128_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename T>
+struct DictionaryEncodingResult {
+  std::shared_ptr<std::vector<T>> dictionary;
+  std::shared_ptr<BaseAttributeVector> attribute_vector;
+};
+
+// Dictionary-encodes a vector of values in bulk. This is what DictionarySegment and FrontCodedDictionarySegment are
+// built with.
+//
+// The distinct values are collected in a hash map and only those are sorted, which is O(n + d log d) for n values with
+// d distinct values. The attribute vector is created with its final size and each row's value id is looked up in the
+// hash map. For large inputs, the rows are split into ranges that are filled by several threads. The ranges are
+// aligned to 128 rows, so that no two threads write to the same word of a bit-packed attribute vector.
+template <typename T>
+DictionaryEncodingResult<T> encode_dictionary(const std::vector<T>& values,
+                                              const AttributeVectorEncoding attribute_vector_encoding) {
+  constexpr auto rows_per_thread = size_t{1} << 17;
+  constexpr auto range_alignment = size_t{128};
+
+  auto value_ids = std::unordered_map<T, ValueID>{};
+  for (const auto& value : values) {
+    value_ids.emplace(value, ValueID{0});
+  }
+
+  auto dictionary = std::make_shared<std::vector<T>>();
+  dictionary->reserve(value_ids.size());
+  for (const auto& value_and_value_id : value_ids) {
+    dictionary->push_back(value_and_value_id.first);
+  }
+  std::sort(dictionary->begin(), dictionary->end());
+
+  for (auto value_id = ValueID{0}; value_id < dictionary->size(); ++value_id) {
+    value_ids[(*dictionary)[value_id]] = value_id;
+  }
+
+  // calls write_value_id(position, value_id) for every row, on several threads if there are enough rows. The hash map
+  // is only read from here on, so it can be shared between the threads.
+  const auto for_each_value_id = [&](const auto& write_value_id) {
+    const auto fill_range = [&](const size_t begin, const size_t end) {
+      for (auto position = begin; position < end; ++position) {
+        write_value_id(position, value_ids.find(values[position])->second);
+      }
+    };
+
+    const auto hardware_threads = static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u));
+    const auto thread_count = std::min(hardware_threads, std::max(values.size() / rows_per_thread, size_t{1}));
+    if (thread_count == 1) {
+      fill_range(0, values.size());
+      return;
+    }
+
+    const auto rows_per_range =
+        (values.size() / thread_count + range_alignment - 1) / range_alignment * range_alignment;
+    auto threads = std::vector<std::thread>{};
+    threads.reserve(thread_count);
+    for (auto begin = size_t{0}; begin < values.size(); begin += rows_per_range) {
+      threads.emplace_back(fill_range, begin, std::min(begin + rows_per_range, values.size()));
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  };
+
+  const auto dictionary_size = dictionary->size();
+  auto attribute_vector = std::shared_ptr<BaseAttributeVector>{};
+
+  if (attribute_vector_encoding == AttributeVectorEncoding::SimdBp128) {
+    // the bit width of each block depends on all of its value ids, so they are collected before packing
+    auto all_value_ids = std::vector<ValueID>(values.size());
+    for_each_value_id([&](const size_t position, const ValueID value_id) { all_value_ids[position] = value_id; });
+    attribute_vector = std::make_shared<SimdBp128AttributeVector>(all_value_ids);
+  } else {
+    if (attribute_vector_encoding == AttributeVectorEncoding::BitPacked) {
+      const auto max_value_id = dictionary_size == 0 ? size_t{0} : dictionary_size - 1;
+      const auto bit_width =
+          BitPackedAttributeVector::required_bit_width(ValueID{static_cast<ValueID::base_type>(max_value_id)});
+      attribute_vector = std::make_shared<BitPackedAttributeVector>(values.size(), bit_width);
+    } else if (dictionary_size <= std::numeric_limits<uint8_t>::max()) {
+      attribute_vector = std::make_shared<FixedSizeAttributeVector<uint8_t>>(values.size());
+    } else if (dictionary_size <= std::numeric_limits<uint16_t>::max()) {
+      attribute_vector = std::make_shared<FixedSizeAttributeVector<uint16_t>>(values.size());
+    } else {
+      attribute_vector = std::make_shared<FixedSizeAttributeVector<uint32_t>>(values.size());
+    }
+
+    for_each_value_id(
+        [&](const size_t position, const ValueID value_id) { attribute_vector->set(position, value_id); });
+  }
+
+  return {std::move(dictionary), std::move(attribute_vector)};
+}
+
+}  // namespace opossum
@@ -0,0 +1,342 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "cold_segment.hpp"
+#include "delta_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "front_coded_dictionary.hpp"
+#include "resolve_type.hpp"
+#include "simd_bp128_attribute_vector.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the sample consists of this many contiguous windows spread evenly over the segment, so that runs can be observed
+constexpr size_t sample_window_count = 16;
+
+// candidates whose primary criterion is within this factor of the best one are considered equally good
+constexpr double near_tie_factor = 1.1;
+
+// Rough relative costs of scanning one row. Scans on dictionaries compare value ids, which is cheapest on byte-aligned
+// attribute vectors. Bit-packed value ids have to be unpacked one by one, SIMD-BP128 unpacks whole blocks at once.
+// Front coding only makes the bound lookups more expensive, which does not depend on the number of rows.
+constexpr double fixed_size_scan_cost = 1.0;
+constexpr double simd_bp128_scan_cost = 1.2;
+constexpr double frame_of_reference_scan_cost = 1.3;
+constexpr double bit_packed_scan_cost = 1.6;
+// deltas have to be summed up, unless the segment is sorted and can be binary-searched
+constexpr double delta_scan_cost = 1.8;
+constexpr double front_coded_scan_overhead = 0.05;
+// run-length segments are scanned run by run, where each run costs about as much as two dictionary rows
+constexpr double run_scan_cost = 2.0;
+
+uint8_t bit_width_for_count(const size_t distinct_count) {
+  const auto max_value_id = distinct_count == 0 ? size_t{0} : distinct_count - 1;
+  return BitPackedAttributeVector::required_bit_width(ValueID{static_cast<ValueID::base_type>(max_value_id)});
+}
+
+size_t bit_packed_size(const size_t row_count, const uint8_t bit_width) {
+  return (row_count * bit_width + 63) / 64 * sizeof(uint64_t);
+}
+
+size_t fixed_size_width(const size_t distinct_count) {
+  if (distinct_count <= std::numeric_limits<uint8_t>::max()) return sizeof(uint8_t);
+  if (distinct_count <= std::numeric_limits<uint16_t>::max()) return sizeof(uint16_t);
+  return sizeof(uint32_t);
+}
+
+// Estimates the number of distinct values from a sample with the GEE estimator: values seen more than once in the
+// sample are probably frequent in the whole segment as well, values seen once stand for sqrt(n / r) distinct values.
+size_t estimate_distinct_count(const size_t row_count, const size_t sampled_row_count,
+                               const size_t sampled_distinct_count, const size_t singleton_count) {
+  if (sampled_row_count == row_count) return sampled_distinct_count;
+  // a sample without any repeated value most likely comes from a unique column, where GEE underestimates heavily
+  if (singleton_count == sampled_row_count) return row_count;
+  const auto scale = std::sqrt(static_cast<double>(row_count) / static_cast<double>(sampled_row_count));
+  const auto estimate = scale * singleton_count + (sampled_distinct_count - singleton_count);
+  return std::clamp(static_cast<size_t>(estimate), sampled_distinct_count, row_count);
+}
+
+template <typename T>
+std::optional<uint8_t> frame_of_reference_bit_width(const std::vector<T>& values) {
+  const auto max_range = FrameOfReferenceSegment<T>::max_block_range(values);
+  if (max_range > std::numeric_limits<uint32_t>::max()) return std::nullopt;
+  return BitPackedAttributeVector::required_bit_width(ValueID{static_cast<uint32_t>(max_range)});
+}
+
+// returns the average number of bits a DeltaSegment would need per value, measured on pieces of the sample windows
+// that are as long as a DeltaSegment block
+template <typename T>
+double average_delta_bit_width(const std::vector<T>& values, const std::vector<std::pair<size_t, size_t>>& windows) {
+  using UnsignedT = std::make_unsigned_t<T>;
+  constexpr auto block_size = size_t{DeltaSegment<T>::block_size};
+
+  auto total_bits = size_t{0};
+  auto value_count = size_t{0};
+  for (const auto& window : windows) {
+    for (auto block_begin = window.first; block_begin < window.second; block_begin += block_size) {
+      const auto block_end = std::min(block_begin + block_size, window.second);
+      auto min_delta = std::numeric_limits<T>::max();
+      auto max_delta = std::numeric_limits<T>::min();
+      for (auto position = block_begin + 1; position < block_end; ++position) {
+        const auto delta = static_cast<T>(static_cast<UnsignedT>(values[position]) -
+                                          static_cast<UnsignedT>(values[position - 1]));
+        min_delta = std::min(min_delta, delta);
+        max_delta = std::max(max_delta, delta);
+      }
+      if (block_end - block_begin > 1) {
+        const auto max_offset = static_cast<UnsignedT>(static_cast<UnsignedT>(max_delta) -
+                                                       static_cast<UnsignedT>(min_delta));
+        auto bit_width = size_t{0};
+        while (bit_width < sizeof(UnsignedT) * 8 && (max_offset >> bit_width) != 0) ++bit_width;
+        total_bits += bit_width * (block_end - block_begin - 1);
+      }
+      value_count += block_end - block_begin;
+    }
+  }
+  return value_count == 0 ? 0.0 : static_cast<double>(total_bits) / static_cast<double>(value_count);
+}
+
+template <typename T>
+SegmentCharacteristics analyze(const std::vector<T>& values, const size_t sample_size) {
+  auto characteristics = SegmentCharacteristics{};
+  characteristics.row_count = values.size();
+
+  // the windows of the sample, as [begin, end) pairs
+  auto windows = std::vector<std::pair<size_t, size_t>>{};
+  if (values.size() <= sample_size) {
+    windows.emplace_back(0, values.size());
+  } else {
+    const auto window_size = std::max(sample_size / sample_window_count, size_t{1});
+    const auto window_distance = values.size() / sample_window_count;
+    for (auto window_index = size_t{0}; window_index < sample_window_count; ++window_index) {
+      const auto begin = window_index * window_distance;
+      windows.emplace_back(begin, std::min(begin + window_size, values.size()));
+    }
+  }
+
+  auto occurrences = std::unordered_map<T, size_t>{};
+  auto run_count = size_t{0};
+  for (const auto& window : windows) {
+    for (auto position = window.first; position < window.second; ++position) {
+      ++occurrences[values[position]];
+      if (position == window.first || values[position] != values[position - 1]) ++run_count;
+    }
+    characteristics.sampled_row_count += window.second - window.first;
+  }
+
+  if (characteristics.sampled_row_count == 0) return characteristics;
+
+  const auto singleton_count =
+      static_cast<size_t>(std::count_if(occurrences.cbegin(), occurrences.cend(),
+                                        [](const auto& value_and_count) { return value_and_count.second == 1; }));
+  characteristics.estimated_distinct_count = estimate_distinct_count(
+      characteristics.row_count, characteristics.sampled_row_count, occurrences.size(), singleton_count);
+  characteristics.average_run_length =
+      static_cast<double>(characteristics.sampled_row_count) / static_cast<double>(run_count);
+
+  if constexpr (std::is_integral_v<T>) {
+    characteristics.frame_of_reference_bit_width = frame_of_reference_bit_width(values);
+    characteristics.average_delta_bit_width = average_delta_bit_width(values, windows);
+  }
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto sorted_values = std::vector<std::string>{};
+    sorted_values.reserve(occurrences.size());
+    auto total_length = size_t{0};
+    for (const auto& value_and_count : occurrences) {
+      sorted_values.push_back(value_and_count.first);
+      total_length += value_and_count.first.size();
+    }
+    std::sort(sorted_values.begin(), sorted_values.end());
+
+    // the sample is sparser than the whole dictionary, so this overestimates what front coding has to store
+    auto front_coded_length = size_t{0};
+    for (auto index = size_t{0}; index < sorted_values.size(); ++index) {
+      const auto& value = sorted_values[index];
+      auto prefix_length = size_t{0};
+      if (index % FrontCodedDictionary::block_size != 0) {
+        const auto& previous_value = sorted_values[index - 1];
+        prefix_length = static_cast<size_t>(
+            std::mismatch(previous_value.cbegin(), previous_value.cend(), value.cbegin(), value.cend()).second -
+            value.cbegin());
+      }
+      // one byte for each varint length, which covers all but very long strings
+      front_coded_length += value.size() - prefix_length + (index % FrontCodedDictionary::block_size == 0 ? 1 : 2);
+    }
+
+    characteristics.average_string_length = static_cast<double>(total_length) / sorted_values.size();
+    characteristics.average_front_coded_length = static_cast<double>(front_coded_length) / sorted_values.size();
+  }
+
+  return characteristics;
+}
+
+template <typename T>
+std::vector<EncodingCandidate> candidates_for(const SegmentCharacteristics& characteristics) {
+  const auto row_count = characteristics.row_count;
+  const auto distinct_count = characteristics.estimated_distinct_count;
+  const auto run_count = static_cast<size_t>(std::ceil(row_count / characteristics.average_run_length));
+
+  auto value_size = double{sizeof(T)};
+  if constexpr (std::is_same_v<T, std::string>) {
+    value_size += characteristics.average_string_length;
+  }
+  const auto dictionary_size = static_cast<size_t>(distinct_count * value_size);
+  const auto bit_width = bit_width_for_count(distinct_count);
+  const auto fixed_size_attribute_vector_size = row_count * fixed_size_width(distinct_count);
+  const auto bit_packed_attribute_vector_size = bit_packed_size(row_count, bit_width);
+  // blocks may use fewer bits than the whole segment needs, each block stores its bit width
+  const auto simd_bp128_attribute_vector_size =
+      bit_packed_attribute_vector_size + (row_count + SimdBp128AttributeVector::block_size - 1) /
+                                             SimdBp128AttributeVector::block_size;
+
+  auto candidates = std::vector<EncodingCandidate>{
+      {{EncodingType::Dictionary, AttributeVectorEncoding::FixedSize},
+       dictionary_size + fixed_size_attribute_vector_size,
+       fixed_size_scan_cost},
+      {{EncodingType::Dictionary, AttributeVectorEncoding::BitPacked},
+       dictionary_size + bit_packed_attribute_vector_size,
+       bit_packed_scan_cost},
+      {{EncodingType::Dictionary, AttributeVectorEncoding::SimdBp128},
+       dictionary_size + simd_bp128_attribute_vector_size,
+       simd_bp128_scan_cost},
+      {{EncodingType::RunLength},
+       static_cast<size_t>(run_count * (value_size + sizeof(ChunkOffset))),
+       run_scan_cost / characteristics.average_run_length}};
+
+  if constexpr (std::is_integral_v<T>) {
+    if (characteristics.frame_of_reference_bit_width) {
+      constexpr auto block_size = size_t{FrameOfReferenceSegment<T>::block_size};
+      const auto block_count = (row_count + block_size - 1) / block_size;
+      candidates.push_back(
+          {{EncodingType::FrameOfReference},
+           block_count * sizeof(T) + bit_packed_size(row_count, *characteristics.frame_of_reference_bit_width),
+           frame_of_reference_scan_cost});
+    }
+
+    constexpr auto delta_block_size = size_t{DeltaSegment<T>::block_size};
+    const auto delta_block_count = (row_count + delta_block_size - 1) / delta_block_size;
+    // anchor, smallest delta, bit width and word offset per block, and on average half a word of padding
+    const auto delta_block_overhead = 2 * sizeof(T) + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint64_t) / 2;
+    candidates.push_back(
+        {{EncodingType::Delta},
+         delta_block_count * delta_block_overhead +
+             static_cast<size_t>(row_count * characteristics.average_delta_bit_width / 8),
+         delta_scan_cost});
+  }
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto block_count = (distinct_count + FrontCodedDictionary::block_size - 1) / FrontCodedDictionary::block_size;
+    const auto front_coded_dictionary_size =
+        static_cast<size_t>(distinct_count * characteristics.average_front_coded_length) +
+        block_count * sizeof(uint32_t);
+    candidates.push_back({{EncodingType::FrontCodedDictionary, AttributeVectorEncoding::FixedSize},
+                          front_coded_dictionary_size + fixed_size_attribute_vector_size,
+                          fixed_size_scan_cost + front_coded_scan_overhead});
+    candidates.push_back({{EncodingType::FrontCodedDictionary, AttributeVectorEncoding::BitPacked},
+                          front_coded_dictionary_size + bit_packed_attribute_vector_size,
+                          bit_packed_scan_cost + front_coded_scan_overhead});
+  }
+
+  return candidates;
+}
+
+// returns the candidate that is best in `primary`, preferring the best in `secondary` among near-ties
+template <typename Primary, typename Secondary>
+const EncodingCandidate& choose(const std::vector<EncodingCandidate>& candidates, const Primary& primary,
+                                const Secondary& secondary) {
+  DebugAssert(!candidates.empty(), "There has to be at least one candidate.");
+  auto best_primary = std::numeric_limits<double>::max();
+  for (const auto& candidate : candidates) {
+    best_primary = std::min(best_primary, static_cast<double>(primary(candidate)));
+  }
+
+  const EncodingCandidate* chosen = nullptr;
+  for (const auto& candidate : candidates) {
+    if (primary(candidate) > best_primary * near_tie_factor) continue;
+    if (!chosen || secondary(candidate) < secondary(*chosen)) chosen = &candidate;
+  }
+  return *chosen;
+}
+
+}  // namespace
+
+EncodingAdvisor::EncodingAdvisor(const EncodingGoal goal, const size_t sample_size)
+    : _goal(goal), _sample_size(sample_size) {
+  Assert(sample_size > 0, "The sample size has to be positive.");
+}
+
+std::vector<SegmentEncodingSpec> EncodingAdvisor::advise(const Table& table, const ChunkID chunk_id) {
+  const auto& chunk = table.get_chunk(chunk_id);
+  auto specs = std::vector<SegmentEncodingSpec>{};
+  auto decisions = std::vector<EncodingDecision>{};
+
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    auto segment = chunk.get_segment(column_id);
+    if (const auto cold_segment = std::dynamic_pointer_cast<ColdSegment>(segment)) segment = cold_segment->segment();
+    auto decision = advise_segment(table.column_type(column_id), segment);
+    decision.chunk_id = chunk_id;
+    decision.column_id = column_id;
+    specs.push_back(decision.chosen_spec);
+    decisions.push_back(std::move(decision));
+  }
+
+  std::lock_guard<std::mutex> lock_guard(*_decisions_mutex);
+  _decisions.insert(_decisions.end(), std::make_move_iterator(decisions.begin()),
+                    std::make_move_iterator(decisions.end()));
+  return specs;
+}
+
+EncodingDecision EncodingAdvisor::advise_segment(const std::string& type,
+                                                 const std::shared_ptr<BaseSegment>& value_segment) const {
+  auto decision = EncodingDecision{};
+  decision.column_type = type;
+
+  resolve_data_type(type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    const auto typed_segment = std::dynamic_pointer_cast<const ValueSegment<Type>>(value_segment);
+    Assert(typed_segment, "Only ValueSegments can be analyzed.");
+
+    decision.characteristics = analyze(typed_segment->values(), _sample_size);
+    decision.candidates = candidates_for<Type>(decision.characteristics);
+  });
+  Assert(!decision.candidates.empty(), "Unknown column type " + type);
+
+  const auto memory_usage = [](const EncodingCandidate& candidate) { return candidate.estimated_memory_usage; };
+  const auto scan_cost = [](const EncodingCandidate& candidate) { return candidate.relative_scan_cost; };
+  decision.chosen_spec = _goal == EncodingGoal::SmallestMemory
+                             ? choose(decision.candidates, memory_usage, scan_cost).spec
+                             : choose(decision.candidates, scan_cost, memory_usage).spec;
+  return decision;
+}
+
+std::vector<EncodingDecision> EncodingAdvisor::decisions() const {
+  std::lock_guard<std::mutex> lock_guard(*_decisions_mutex);
+  return _decisions;
+}
+
+void EncodingAdvisor::clear_decisions() {
+  std::lock_guard<std::mutex> lock_guard(*_decisions_mutex);
+  _decisions.clear();
+}
+
+EncodingGoal EncodingAdvisor::goal() const { return _goal; }
+
+void EncodingAdvisor::set_goal(const EncodingGoal goal) { _goal = goal; }
+
+}  // namespace opossum
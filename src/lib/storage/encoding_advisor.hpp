@@ -0,0 +1,94 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Table;
+
+// what the EncodingAdvisor optimizes for. The other criterion only breaks near-ties.
+enum class EncodingGoal : uint8_t { SmallestMemory, FastestScan };
+
+// properties of a ValueSegment, mostly estimated from a sample
+struct SegmentCharacteristics {
+  size_t row_count = 0;
+  size_t sampled_row_count = 0;
+  size_t estimated_distinct_count = 0;
+  double average_run_length = 1.0;
+
+  // bit width of the largest value range of a FrameOfReference block, only set for int and long columns whose block
+  // ranges fit into 32 bits. This is computed over all values since it decides whether the encoding is possible.
+  std::optional<uint8_t> frame_of_reference_bit_width;
+
+  // only set for int and long columns: the average number of bits per value of a DeltaSegment
+  double average_delta_bit_width = 0.0;
+
+  // only set for string columns: the average string length and the average length of what front coding would have
+  // to store for each string
+  double average_string_length = 0.0;
+  double average_front_coded_length = 0.0;
+};
+
+// an encoding that was considered for a segment, with its estimated size and relative cost of scanning one row
+struct EncodingCandidate {
+  SegmentEncodingSpec spec;
+  size_t estimated_memory_usage = 0;
+  double relative_scan_cost = 0.0;
+};
+
+struct EncodingDecision {
+  ChunkID chunk_id{0};
+  ColumnID column_id{0};
+  std::string column_type;
+  SegmentCharacteristics characteristics;
+  std::vector<EncodingCandidate> candidates;
+  SegmentEncodingSpec chosen_spec;
+};
+
+// The EncodingAdvisor chooses an encoding for each ValueSegment of a chunk before it is compressed. It samples the
+// segment, estimates memory usage and scan cost for every applicable encoding and picks the best one for its goal.
+// All decisions made for a table's chunks are recorded and can be inspected with decisions().
+class EncodingAdvisor : private Noncopyable {
+ public:
+  static constexpr size_t default_sample_size = 8192;
+
+  explicit EncodingAdvisor(const EncodingGoal goal = EncodingGoal::SmallestMemory,
+                           const size_t sample_size = default_sample_size);
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  EncodingAdvisor(EncodingAdvisor&&) = default;
+  EncodingAdvisor& operator=(EncodingAdvisor&&) = default;
+
+  // returns one encoding spec per column of the given chunk, which has to consist of ValueSegments, and records the
+  // decisions
+  std::vector<SegmentEncodingSpec> advise(const Table& table, const ChunkID chunk_id);
+
+  // returns the decision for a single ValueSegment of the given data type without recording it
+  EncodingDecision advise_segment(const std::string& type, const std::shared_ptr<BaseSegment>& value_segment) const;
+
+  // returns all recorded decisions in the order they were made
+  std::vector<EncodingDecision> decisions() const;
+
+  // forgets all recorded decisions
+  void clear_decisions();
+
+  EncodingGoal goal() const;
+  void set_goal(const EncodingGoal goal);
+
+ protected:
+  EncodingGoal _goal;
+  size_t _sample_size;
+  std::vector<EncodingDecision> _decisions;
+  std::unique_ptr<std::mutex> _decisions_mutex = std::make_unique<std::mutex>();
+};
+
+}  // namespace opossum
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace opossum {
+
+// Selects how the value ids of a dictionary-encoded segment are stored.
+// FixedSize uses the smallest of uint8_t/uint16_t/uint32_t, BitPacked uses exactly as many bits as the largest value
+// id needs (1 to 32 bits). SimdBp128 chooses the bit width per block of 128 value ids and decodes them with SIMD.
+enum class AttributeVectorEncoding : uint8_t { FixedSize, BitPacked, SimdBp128 };
+
+// Selects the segment type a ValueSegment is turned into when its chunk is compressed.
+// FrameOfReference and Delta are only available for int and long columns, FrontCodedDictionary only for string columns.
+enum class EncodingType : uint8_t { Dictionary, RunLength, FrameOfReference, FrontCodedDictionary, Delta };
+
+// Describes how a single segment is encoded. The attribute vector encoding only applies to dictionary encodings.
+struct SegmentEncodingSpec {
+  EncodingType encoding_type = EncodingType::Dictionary;
+  AttributeVectorEncoding attribute_vector_encoding = AttributeVectorEncoding::FixedSize;
+};
+
+}  // namespace opossum
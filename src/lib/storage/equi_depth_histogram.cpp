@@ -0,0 +1,248 @@
+#include "equi_depth_histogram.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+struct Bin {
+  T minimum;
+  T maximum;
+  size_t height;
+  size_t distinct_count;
+};
+
+// returns the number of rows the next bin should hold so that the remaining rows are spread evenly
+size_t target_bin_height(const size_t remaining_count, const size_t remaining_bin_count) {
+  return (remaining_count + remaining_bin_count - 1) / remaining_bin_count;
+}
+
+}  // namespace
+
+template <typename T>
+EquiDepthHistogram<T>::EquiDepthHistogram(std::vector<T> bin_minima, std::vector<T> bin_maxima,
+                                          std::vector<size_t> bin_heights, std::vector<size_t> bin_distinct_counts)
+    : _bin_minima(std::move(bin_minima)),
+      _bin_maxima(std::move(bin_maxima)),
+      _bin_heights(std::move(bin_heights)),
+      _bin_distinct_counts(std::move(bin_distinct_counts)) {
+  DebugAssert(_bin_minima.size() == _bin_maxima.size() && _bin_minima.size() == _bin_heights.size() &&
+                  _bin_minima.size() == _bin_distinct_counts.size(),
+              "All bins need a minimum, a maximum, a height and a distinct count.");
+  _total_count = std::accumulate(_bin_heights.cbegin(), _bin_heights.cend(), size_t{0});
+}
+
+template <typename T>
+std::shared_ptr<EquiDepthHistogram<T>> EquiDepthHistogram<T>::from_value_counts(const std::vector<T>& sorted_values,
+                                                                                const std::vector<size_t>& counts,
+                                                                                const size_t bin_count) {
+  DebugAssert(sorted_values.size() == counts.size(), "Need exactly one count per value.");
+  DebugAssert(bin_count > 0, "A histogram needs at least one bin.");
+
+  auto bin_minima = std::vector<T>{};
+  auto bin_maxima = std::vector<T>{};
+  auto bin_heights = std::vector<size_t>{};
+  auto bin_distinct_counts = std::vector<size_t>{};
+
+  auto remaining_count = std::accumulate(counts.cbegin(), counts.cend(), size_t{0});
+  auto remaining_bin_count = std::min(bin_count, sorted_values.size());
+  auto index = size_t{0};
+  while (index < sorted_values.size()) {
+    const auto target_height = target_bin_height(remaining_count, remaining_bin_count);
+    const auto bin_begin = index;
+    auto height = size_t{0};
+    while (index < sorted_values.size() && height < target_height) {
+      height += counts[index];
+      ++index;
+    }
+
+    bin_minima.push_back(sorted_values[bin_begin]);
+    bin_maxima.push_back(sorted_values[index - 1]);
+    bin_heights.push_back(height);
+    bin_distinct_counts.push_back(index - bin_begin);
+
+    remaining_count -= height;
+    if (remaining_bin_count > 1) --remaining_bin_count;
+  }
+
+  return std::make_shared<EquiDepthHistogram<T>>(std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights),
+                                                 std::move(bin_distinct_counts));
+}
+
+template <typename T>
+std::shared_ptr<EquiDepthHistogram<T>> EquiDepthHistogram<T>::merge(
+    const std::vector<std::shared_ptr<const EquiDepthHistogram<T>>>& histograms, const size_t bin_count) {
+  DebugAssert(bin_count > 0, "A histogram needs at least one bin.");
+
+  auto bins = std::vector<Bin<T>>{};
+  auto remaining_count = size_t{0};
+  for (const auto& histogram : histograms) {
+    for (auto bin_id = size_t{0}; bin_id < histogram->bin_count(); ++bin_id) {
+      bins.push_back({histogram->bin_minimum(bin_id), histogram->bin_maximum(bin_id), histogram->bin_height(bin_id),
+                      histogram->bin_distinct_count(bin_id)});
+    }
+    remaining_count += histogram->total_count();
+  }
+  std::sort(bins.begin(), bins.end(), [](const Bin<T>& lhs, const Bin<T>& rhs) {
+    return lhs.minimum < rhs.minimum || (!(rhs.minimum < lhs.minimum) && lhs.maximum < rhs.maximum);
+  });
+
+  auto bin_minima = std::vector<T>{};
+  auto bin_maxima = std::vector<T>{};
+  auto bin_heights = std::vector<size_t>{};
+  auto bin_distinct_counts = std::vector<size_t>{};
+
+  auto remaining_bin_count = std::min(bin_count, bins.size());
+  auto index = size_t{0};
+  while (index < bins.size()) {
+    const auto target_height = target_bin_height(remaining_count, remaining_bin_count);
+    auto merged_bin = bins[index];
+    ++index;
+    while (index < bins.size() && merged_bin.height < target_height) {
+      // overlapping bins, e.g., of chunks with the same values, are assumed to share their values
+      if (merged_bin.maximum < bins[index].minimum) {
+        merged_bin.distinct_count += bins[index].distinct_count;
+      } else {
+        merged_bin.distinct_count = std::max(merged_bin.distinct_count, bins[index].distinct_count);
+      }
+      merged_bin.maximum = std::max(merged_bin.maximum, bins[index].maximum);
+      merged_bin.height += bins[index].height;
+      ++index;
+    }
+
+    merged_bin.distinct_count = std::min(merged_bin.distinct_count, merged_bin.height);
+    if constexpr (std::is_integral_v<T>) {
+      const auto range_size = static_cast<double>(merged_bin.maximum) - static_cast<double>(merged_bin.minimum) + 1;
+      merged_bin.distinct_count =
+          static_cast<size_t>(std::min(static_cast<double>(merged_bin.distinct_count), range_size));
+    }
+
+    bin_minima.push_back(std::move(merged_bin.minimum));
+    bin_maxima.push_back(std::move(merged_bin.maximum));
+    bin_heights.push_back(merged_bin.height);
+    bin_distinct_counts.push_back(merged_bin.distinct_count);
+
+    remaining_count -= merged_bin.height;
+    if (remaining_bin_count > 1) --remaining_bin_count;
+  }
+
+  return std::make_shared<EquiDepthHistogram<T>>(std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights),
+                                                 std::move(bin_distinct_counts));
+}
+
+template <typename T>
+double EquiDepthHistogram<T>::estimate_cardinality(const ScanType scan_type, const AllTypeVariant& value) const {
+  return estimate_cardinality(scan_type, type_cast<T>(value));
+}
+
+template <typename T>
+double EquiDepthHistogram<T>::estimate_cardinality(const ScanType scan_type, const T& value) const {
+  auto less_than = 0.0;
+  auto equals = 0.0;
+  for (auto bin_id = size_t{0}; bin_id < _bin_heights.size(); ++bin_id) {
+    less_than += _estimate_less_than(bin_id, value);
+    equals += _estimate_equals(bin_id, value);
+  }
+
+  const auto total_count = static_cast<double>(_total_count);
+  const auto less_than_equals = std::min(total_count, less_than + equals);
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return equals;
+    case ScanType::OpNotEquals:
+      return total_count - equals;
+    case ScanType::OpLessThan:
+      return less_than;
+    case ScanType::OpLessThanEquals:
+      return less_than_equals;
+    case ScanType::OpGreaterThan:
+      return total_count - less_than_equals;
+    case ScanType::OpGreaterThanEquals:
+      return total_count - less_than;
+    case ScanType::OpBetween:
+      Fail("OpBetween needs an upper search value.");
+      return 0.0;
+  }
+  Fail("Unknown scan type.");
+  return 0.0;
+}
+
+template <typename T>
+double EquiDepthHistogram<T>::_estimate_less_than(const size_t bin_id, const T& value) const {
+  const auto& minimum = _bin_minima[bin_id];
+  const auto& maximum = _bin_maxima[bin_id];
+  const auto height = static_cast<double>(_bin_heights[bin_id]);
+  if (!(minimum < value)) return 0.0;
+  if (maximum < value) return height;
+
+  // minimum < value <= maximum
+  if constexpr (std::is_integral_v<T>) {
+    const auto range_size = static_cast<double>(maximum) - static_cast<double>(minimum) + 1;
+    return height * (static_cast<double>(value) - static_cast<double>(minimum)) / range_size;
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return height * (static_cast<double>(value) - minimum) / (static_cast<double>(maximum) - minimum);
+  } else {
+    return height / 2;
+  }
+}
+
+template <typename T>
+double EquiDepthHistogram<T>::_estimate_equals(const size_t bin_id, const T& value) const {
+  if (value < _bin_minima[bin_id] || _bin_maxima[bin_id] < value) return 0.0;
+  return static_cast<double>(_bin_heights[bin_id]) / static_cast<double>(_bin_distinct_counts[bin_id]);
+}
+
+template <typename T>
+size_t EquiDepthHistogram<T>::total_count() const {
+  return _total_count;
+}
+
+template <typename T>
+size_t EquiDepthHistogram<T>::total_distinct_count() const {
+  return std::accumulate(_bin_distinct_counts.cbegin(), _bin_distinct_counts.cend(), size_t{0});
+}
+
+template <typename T>
+size_t EquiDepthHistogram<T>::bin_count() const {
+  return _bin_heights.size();
+}
+
+template <typename T>
+const T& EquiDepthHistogram<T>::bin_minimum(const size_t bin_id) const {
+  return _bin_minima.at(bin_id);
+}
+
+template <typename T>
+const T& EquiDepthHistogram<T>::bin_maximum(const size_t bin_id) const {
+  return _bin_maxima.at(bin_id);
+}
+
+template <typename T>
+size_t EquiDepthHistogram<T>::bin_height(const size_t bin_id) const {
+  return _bin_heights.at(bin_id);
+}
+
+template <typename T>
+size_t EquiDepthHistogram<T>::bin_distinct_count(const size_t bin_id) const {
+  return _bin_distinct_counts.at(bin_id);
+}
+
+template <typename T>
+size_t EquiDepthHistogram<T>::estimate_memory_usage() const {
+  return _bin_heights.size() * (2 * sizeof(T) + 2 * sizeof(size_t));
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(EquiDepthHistogram);
+
+}  // namespace opossum
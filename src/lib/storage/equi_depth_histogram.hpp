@@ -0,0 +1,95 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// AbstractHistogram allows estimating the number of rows that satisfy a predicate without knowing the column's type.
+class AbstractHistogram : private Noncopyable {
+ public:
+  AbstractHistogram() = default;
+  virtual ~AbstractHistogram() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  AbstractHistogram(AbstractHistogram&&) = default;
+  AbstractHistogram& operator=(AbstractHistogram&&) = default;
+
+  // returns the estimated number of values v for which `v <scan_type> value` holds
+  virtual double estimate_cardinality(const ScanType scan_type, const AllTypeVariant& value) const = 0;
+
+  // returns the number of values the histogram was built from
+  virtual size_t total_count() const = 0;
+
+  // returns the (estimated) number of distinct values the histogram was built from
+  virtual size_t total_distinct_count() const = 0;
+
+  // returns the number of bins
+  virtual size_t bin_count() const = 0;
+
+  // returns the calculated memory usage
+  virtual size_t estimate_memory_usage() const = 0;
+};
+
+// EquiDepthHistogram splits the values of a column into bins that hold roughly the same number of values. A value
+// never spans two bins, so bins of frequent values may be larger than others. Each bin stores its smallest and largest
+// value, its height (number of values) and its number of distinct values.
+//
+// Within a bin, values are assumed to be distributed uniformly over the bin's range, and each distinct value is
+// assumed to occur equally often. Ranges of strings cannot be interpolated, so a bin that contains the search value of
+// a range predicate counts as half matching.
+template <typename T>
+class EquiDepthHistogram : public AbstractHistogram {
+ public:
+  static constexpr size_t default_bin_count = 32;
+
+  EquiDepthHistogram(std::vector<T> bin_minima, std::vector<T> bin_maxima, std::vector<size_t> bin_heights,
+                     std::vector<size_t> bin_distinct_counts);
+
+  // builds a histogram from sorted distinct values and the number of times each of them occurs
+  static std::shared_ptr<EquiDepthHistogram<T>> from_value_counts(const std::vector<T>& sorted_values,
+                                                                  const std::vector<size_t>& counts,
+                                                                  const size_t bin_count = default_bin_count);
+
+  // Merges histograms, e.g., of the segments of all chunks, into one with at most `bin_count` bins. The bins of all
+  // histograms are sorted and neighboring bins are combined until they reach the target height. Bins of different
+  // histograms may overlap; overlapping bins are assumed to share their values, so only disjoint bins add up their
+  // distinct counts.
+  static std::shared_ptr<EquiDepthHistogram<T>> merge(const std::vector<std::shared_ptr<const EquiDepthHistogram<T>>>&
+                                                          histograms,
+                                                      const size_t bin_count = default_bin_count);
+
+  double estimate_cardinality(const ScanType scan_type, const AllTypeVariant& value) const override;
+
+  // same as above, but accepts a value of the histogram's type
+  double estimate_cardinality(const ScanType scan_type, const T& value) const;
+
+  size_t total_count() const override;
+  size_t total_distinct_count() const override;
+  size_t bin_count() const override;
+
+  const T& bin_minimum(const size_t bin_id) const;
+  const T& bin_maximum(const size_t bin_id) const;
+  size_t bin_height(const size_t bin_id) const;
+  size_t bin_distinct_count(const size_t bin_id) const;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  // returns the estimated number of values of a bin that are smaller than / equal to the given value
+  double _estimate_less_than(const size_t bin_id, const T& value) const;
+  double _estimate_equals(const size_t bin_id, const T& value) const;
+
+  std::vector<T> _bin_minima;
+  std::vector<T> _bin_maxima;
+  std::vector<size_t> _bin_heights;
+  std::vector<size_t> _bin_distinct_counts;
+  size_t _total_count = 0;
+};
+
+}  // namespace opossum
@@ -1,16 +1,22 @@
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "base_attribute_vector.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
 template <typename T>
-class FixedSizeAttributeVector : public BaseAttributeVector {
+class FixedSizeAttributeVector final : public BaseAttributeVector {
  public:
   FixedSizeAttributeVector() = default;
+
+  // creates an attribute vector of the given size, whose value ids are then written with set()
+  explicit FixedSizeAttributeVector(const size_t size) : _vector(size) {}
+
   ~FixedSizeAttributeVector() override = default;
 
   // we need to explicitly set the move constructor to default when
@@ -22,7 +28,19 @@ class FixedSizeAttributeVector : public BaseAttributeVector {
   ValueID get(const size_t i) const override { return static_cast<ValueID>(_vector[i]); };
 
   // sets the value id at a given position
-  void set(const size_t i, const ValueID value_id) override { _vector.insert(_vector.cbegin() + i, value_id); };
+  void set(const size_t i, const ValueID value_id) override {
+    DebugAssert(i < _vector.size(), "Position is out of range.");
+    _vector[i] = static_cast<T>(value_id);
+  };
+
+  // writes `count` value ids starting at position `begin` into `out`
+  void decode(const size_t begin, const size_t count, ValueID* out) const override {
+    std::transform(_vector.cbegin() + begin, _vector.cbegin() + begin + count, out,
+                   [](const T value_id) { return static_cast<ValueID>(value_id); });
+  };
+
+  // returns the value ids, so that scans can compare them without calling get() for each one
+  const std::vector<T>& values() const { return _vector; }
 
   // returns the number of values
   size_t size() const override { return _vector.size(); };
@@ -30,6 +48,9 @@ class FixedSizeAttributeVector : public BaseAttributeVector {
   // returns the width of biggest value id in bytes
   AttributeVectorWidth width() const override { return sizeof(T); };
 
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const override { return _vector.size() * sizeof(T); };
+
  protected:
   std::vector<T> _vector;
 };
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/scan_type_utils.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceSegment is a specific segment type for integer columns with a narrow value range. The values are
+// split into blocks, and each value is stored as its bit-packed offset to the minimum of its block. The bit width is
+// the same for all blocks; the value range of each block has to fit into 32 bits.
+template <typename T>
+class FrameOfReferenceSegment : public BaseSegment {
+  static_assert(std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>,
+                "FrameOfReferenceSegment only supports int and long columns.");
+
+  using UnsignedT = std::make_unsigned_t<T>;
+
+ public:
+  static constexpr ChunkOffset block_size = 2048;
+
+  // returns the largest difference between a value and the minimum of its block, which has to fit into 32 bits
+  static uint64_t max_block_range(const std::vector<T>& values) {
+    auto max_range = uint64_t{0};
+    for (auto block_begin = size_t{0}; block_begin < values.size(); block_begin += block_size) {
+      const auto block_end = std::min(block_begin + block_size, values.size());
+      const auto min_max = std::minmax_element(values.cbegin() + block_begin, values.cbegin() + block_end);
+      max_range = std::max(max_range, uint64_t{_offset_to(*min_max.second, *min_max.first)});
+    }
+    return max_range;
+  }
+
+  /**
+   * Creates a FrameOfReference segment from a given value segment.
+   */
+  explicit FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment)
+      : _block_minima(std::make_shared<std::vector<T>>()) {
+    const auto value_segment = std::static_pointer_cast<ValueSegment<T>>(base_segment);
+    const auto& values = value_segment->values();
+
+    // first pass: find the minimum of each block and the largest offset, which determines the bit width
+    auto max_offset = uint64_t{0};
+    for (auto block_begin = size_t{0}; block_begin < values.size(); block_begin += block_size) {
+      const auto block_end = std::min(block_begin + block_size, values.size());
+      const auto min_max = std::minmax_element(values.cbegin() + block_begin, values.cbegin() + block_end);
+      _block_minima->push_back(*min_max.first);
+      max_offset = std::max(max_offset, uint64_t{_offset_to(*min_max.second, *min_max.first)});
+    }
+    Assert(max_offset <= std::numeric_limits<uint32_t>::max(), "The value range of a block has to fit into 32 bits.");
+
+    // second pass: store the offsets
+    const auto bit_width = BitPackedAttributeVector::required_bit_width(ValueID{static_cast<uint32_t>(max_offset)});
+    _offsets = std::make_shared<BitPackedAttributeVector>(values.size(), bit_width);
+    for (auto position = size_t{0}; position < values.size(); ++position) {
+      const auto minimum = (*_block_minima)[position / block_size];
+      _offsets->set(position, ValueID{static_cast<uint32_t>(_offset_to(values[position], minimum))});
+    }
+  }
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override { return get(chunk_offset); }
+
+  // return the value at a certain position.
+  T get(const ChunkOffset chunk_offset) const {
+    const auto minimum = (*_block_minima)[chunk_offset / block_size];
+    return static_cast<T>(static_cast<UnsignedT>(minimum) + static_cast<UnsignedT>(_offsets->get(chunk_offset)));
+  }
+
+  // frame-of-reference segments are immutable
+  void append(const AllTypeVariant&) override { throw std::runtime_error("FrameOfReference segments are immutable."); }
+
+  // appends the chunk offsets of all values v for which `v <scan_type> search_value` holds to `matches`.
+  // The search value is translated into each block's offset domain so that the packed offsets are compared directly.
+  void scan(const ScanType scan_type, const T search_value, std::vector<ChunkOffset>& matches) const {
+    const auto max_offset = (uint64_t{1} << _offsets->bit_width()) - 1;
+    auto offsets = std::vector<ValueID>(block_size);
+
+    with_comparator(scan_type, [&](auto comparator) {
+      for (auto block_index = size_t{0}; block_index < _block_minima->size(); ++block_index) {
+        const auto block_begin = static_cast<ChunkOffset>(block_index * block_size);
+        const auto block_end = std::min(block_begin + block_size, static_cast<ChunkOffset>(size()));
+        const auto minimum = (*_block_minima)[block_index];
+
+        // if the search value is outside of the range the block can represent, all of its values are either larger or
+        // smaller than the search value - the block's minimum decides for all of them
+        if (search_value < minimum || _offset_to(search_value, minimum) > max_offset) {
+          if (comparator(minimum, search_value)) {
+            for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+              matches.push_back(chunk_offset);
+            }
+          }
+          continue;
+        }
+
+        const auto search_offset = static_cast<uint32_t>(_offset_to(search_value, minimum));
+        _offsets->decode(block_begin, block_end - block_begin, offsets.data());
+        for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+          if (comparator(static_cast<uint32_t>(offsets[chunk_offset - block_begin]), search_offset)) {
+            matches.push_back(chunk_offset);
+          }
+        }
+      }
+    });
+  }
+
+  // returns the minimum of each block
+  std::shared_ptr<const std::vector<T>> block_minima() const { return _block_minima; }
+
+  // returns the offsets of all values to their block's minimum
+  std::shared_ptr<const BitPackedAttributeVector> offsets() const { return _offsets; }
+
+  // return the number of entries
+  size_t size() const override { return _offsets->size(); }
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final {
+    return _block_minima->size() * sizeof(T) + _offsets->estimate_memory_usage();
+  }
+
+ protected:
+  // returns value - minimum without overflowing, requires value >= minimum
+  static UnsignedT _offset_to(const T value, const T minimum) {
+    return static_cast<UnsignedT>(static_cast<UnsignedT>(value) - static_cast<UnsignedT>(minimum));
+  }
+
+  std::shared_ptr<std::vector<T>> _block_minima;
+  std::shared_ptr<BitPackedAttributeVector> _offsets;
+};
+
+}  // namespace opossum
@@ -0,0 +1,148 @@
+#include "front_coded_dictionary.hpp"
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+void append_varint(std::vector<char>& data, size_t value) {
+  while (value >= 0x80) {
+    data.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  data.push_back(static_cast<char>(value));
+}
+
+// reads a varint and advances `position` behind it
+size_t read_varint(const char*& position) {
+  auto value = size_t{0};
+  auto shift = 0;
+  while (true) {
+    const auto byte = static_cast<uint8_t>(*position++);
+    value |= static_cast<size_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) return value;
+    shift += 7;
+  }
+}
+
+}  // namespace
+
+FrontCodedDictionary::FrontCodedDictionary(const std::vector<std::string>& sorted_values)
+    : _size(sorted_values.size()) {
+  DebugAssert(std::adjacent_find(sorted_values.cbegin(), sorted_values.cend(), std::greater_equal<>{}) ==
+                  sorted_values.cend(),
+              "Values have to be sorted and unique.");
+
+  _block_offsets.reserve((_size + block_size - 1) / block_size);
+
+  for (auto index = size_t{0}; index < _size; ++index) {
+    const auto& value = sorted_values[index];
+
+    if (index % block_size == 0) {
+      _block_offsets.push_back(static_cast<uint32_t>(_data.size()));
+      append_varint(_data, value.size());
+      _data.insert(_data.end(), value.cbegin(), value.cend());
+      continue;
+    }
+
+    const auto& previous_value = sorted_values[index - 1];
+    const auto shared_prefix_end =
+        std::mismatch(previous_value.cbegin(), previous_value.cend(), value.cbegin(), value.cend()).second;
+    const auto prefix_length = static_cast<size_t>(shared_prefix_end - value.cbegin());
+
+    append_varint(_data, prefix_length);
+    append_varint(_data, value.size() - prefix_length);
+    _data.insert(_data.end(), shared_prefix_end, value.cend());
+  }
+
+  _data.shrink_to_fit();
+}
+
+std::string FrontCodedDictionary::value_by_value_id(const ValueID value_id) const {
+  DebugAssert(value_id < _size, "Value id is out of range.");
+  const auto* position = _data.data() + _block_offsets[value_id / block_size];
+
+  const auto head_length = read_varint(position);
+  auto value = std::string{position, head_length};
+  position += head_length;
+
+  for (auto index = size_t{0}; index < value_id % block_size; ++index) {
+    const auto prefix_length = read_varint(position);
+    const auto suffix_length = read_varint(position);
+    value.resize(prefix_length);
+    value.append(position, suffix_length);
+    position += suffix_length;
+  }
+
+  return value;
+}
+
+ValueID FrontCodedDictionary::lower_bound(const std::string& value) const {
+  return _partition_point([&](const std::string_view candidate) { return candidate >= value; });
+}
+
+ValueID FrontCodedDictionary::upper_bound(const std::string& value) const {
+  return _partition_point([&](const std::string_view candidate) { return candidate > value; });
+}
+
+size_t FrontCodedDictionary::size() const { return _size; }
+
+size_t FrontCodedDictionary::estimate_memory_usage() const {
+  return _data.size() * sizeof(char) + _block_offsets.size() * sizeof(uint32_t);
+}
+
+std::string_view FrontCodedDictionary::_block_head(const size_t block_index) const {
+  const auto* position = _data.data() + _block_offsets[block_index];
+  const auto head_length = read_varint(position);
+  return std::string_view{position, head_length};
+}
+
+template <typename Predicate>
+ValueID FrontCodedDictionary::_partition_point(const Predicate& is_match) const {
+  // binary search for the first block whose head matches, the heads are not compressed
+  auto first_matching_block = size_t{0};
+  auto block_count = _block_offsets.size();
+  while (block_count > 0) {
+    const auto step = block_count / 2;
+    if (is_match(_block_head(first_matching_block + step))) {
+      block_count = step;
+    } else {
+      first_matching_block += step + 1;
+      block_count -= step + 1;
+    }
+  }
+
+  if (first_matching_block == 0) return ValueID{0};
+
+  // the first match, if any, follows the head of the previous block, which does not match itself
+  const auto block_index = first_matching_block - 1;
+  const auto block_end = std::min(first_matching_block * block_size, _size);
+  const auto* position = _data.data() + _block_offsets[block_index];
+
+  const auto head_length = read_varint(position);
+  auto value = std::string{position, head_length};
+  position += head_length;
+
+  for (auto value_id = block_index * block_size + 1; value_id < block_end; ++value_id) {
+    const auto prefix_length = read_varint(position);
+    const auto suffix_length = read_varint(position);
+    value.resize(prefix_length);
+    value.append(position, suffix_length);
+    position += suffix_length;
+
+    if (is_match(value)) return ValueID{static_cast<ValueID::base_type>(value_id)};
+  }
+
+  return ValueID{static_cast<ValueID::base_type>(block_end)};
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// FrontCodedDictionary is a compressed, sorted and immutable string dictionary.
+//
+// The strings are split into blocks of `block_size`. The first string of each block (its head) is stored in full,
+// each following string only as the length of the prefix it shares with its predecessor plus the remaining suffix.
+// Lengths are varint-encoded. All blocks live in a single contiguous buffer, so there is no per-string allocation or
+// std::string header. Lookups binary-search the block heads and then decode at most one block.
+class FrontCodedDictionary : private Noncopyable {
+ public:
+  static constexpr size_t block_size = 16;
+
+  // creates a dictionary from sorted and unique strings
+  explicit FrontCodedDictionary(const std::vector<std::string>& sorted_values);
+
+  // returns the string with the given value id
+  std::string value_by_value_id(const ValueID value_id) const;
+
+  // returns the value id of the first string >= value, or size() if there is none
+  ValueID lower_bound(const std::string& value) const;
+
+  // returns the value id of the first string > value, or size() if there is none
+  ValueID upper_bound(const std::string& value) const;
+
+  // returns the number of strings
+  size_t size() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // returns the head of the given block without copying it
+  std::string_view _block_head(const size_t block_index) const;
+
+  // returns the value id of the first string for which `is_match` holds, assuming that it holds for all following
+  // strings as well
+  template <typename Predicate>
+  ValueID _partition_point(const Predicate& is_match) const;
+
+  size_t _size = 0;
+  std::vector<uint32_t> _block_offsets;
+  std::vector<char> _data;
+};
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+#include "front_coded_dictionary_segment.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "dictionary_encoder.hpp"
+#include "dictionary_segment.hpp"
+#include "front_coded_dictionary.hpp"
+#include "type_cast.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+FrontCodedDictionarySegment::FrontCodedDictionarySegment(const std::shared_ptr<BaseSegment>& base_segment,
+                                                         const AttributeVectorEncoding attribute_vector_encoding) {
+  const auto value_segment = std::static_pointer_cast<ValueSegment<std::string>>(base_segment);
+  auto encoding_result = encode_dictionary(value_segment->values(), attribute_vector_encoding);
+  // the uncompressed dictionary is only needed until it has been front coded
+  _dictionary = std::make_shared<FrontCodedDictionary>(*encoding_result.dictionary);
+  _attribute_vector = std::move(encoding_result.attribute_vector);
+}
+
+AllTypeVariant FrontCodedDictionarySegment::operator[](const ChunkOffset chunk_offset) const {
+  return get(chunk_offset);
+}
+
+std::string FrontCodedDictionarySegment::get(const size_t chunk_offset) const {
+  return _dictionary->value_by_value_id(_attribute_vector->get(chunk_offset));
+}
+
+void FrontCodedDictionarySegment::append(const AllTypeVariant&) {
+  throw std::runtime_error("Dictionary segments are immutable.");
+}
+
+std::shared_ptr<const FrontCodedDictionary> FrontCodedDictionarySegment::dictionary() const { return _dictionary; }
+
+std::shared_ptr<const BaseAttributeVector> FrontCodedDictionarySegment::attribute_vector() const {
+  return _attribute_vector;
+}
+
+std::string FrontCodedDictionarySegment::value_by_value_id(ValueID value_id) const {
+  return _dictionary->value_by_value_id(value_id);
+}
+
+ValueID FrontCodedDictionarySegment::lower_bound(const std::string& value) const {
+  const auto value_id = _dictionary->lower_bound(value);
+  return value_id == _dictionary->size() ? INVALID_VALUE_ID : value_id;
+}
+
+ValueID FrontCodedDictionarySegment::lower_bound(const AllTypeVariant& value) const {
+  return lower_bound(type_cast<std::string>(value));
+}
+
+ValueID FrontCodedDictionarySegment::upper_bound(const std::string& value) const {
+  const auto value_id = _dictionary->upper_bound(value);
+  return value_id == _dictionary->size() ? INVALID_VALUE_ID : value_id;
+}
+
+ValueID FrontCodedDictionarySegment::upper_bound(const AllTypeVariant& value) const {
+  return upper_bound(type_cast<std::string>(value));
+}
+
+size_t FrontCodedDictionarySegment::unique_values_count() const { return _dictionary->size(); }
+
+size_t FrontCodedDictionarySegment::size() const { return _attribute_vector->size(); }
+
+size_t FrontCodedDictionarySegment::estimate_memory_usage() const {
+  return _dictionary->estimate_memory_usage() + _attribute_vector->estimate_memory_usage();
+}
+
+}  // namespace opossum
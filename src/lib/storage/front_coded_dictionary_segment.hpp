@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "all_type_variant.hpp"
+#include "base_dictionary_segment.hpp"
+#include "encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+class FrontCodedDictionary;
+
+// FrontCodedDictionarySegment is a dictionary-encoded segment for strings whose dictionary is a FrontCodedDictionary
+// instead of a std::vector<std::string>. It offers the same interface as DictionarySegment<std::string>, except that
+// values are returned by value, because they have to be decoded from the dictionary.
+class FrontCodedDictionarySegment : public BaseDictionarySegment {
+ public:
+  /**
+   * Creates a FrontCodedDictionary segment from a given string value segment.
+   */
+  explicit FrontCodedDictionarySegment(
+      const std::shared_ptr<BaseSegment>& base_segment,
+      const AttributeVectorEncoding attribute_vector_encoding = AttributeVectorEncoding::FixedSize);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // return the value at a certain position.
+  std::string get(const size_t chunk_offset) const;
+
+  // dictionary segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // returns an underlying dictionary
+  std::shared_ptr<const FrontCodedDictionary> dictionary() const;
+
+  // returns an underlying data structure
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const override;
+
+  // return the value represented by a given ValueID
+  std::string value_by_value_id(ValueID value_id) const;
+
+  // returns the first value ID that refers to a value >= the search value
+  // returns INVALID_VALUE_ID if all values are smaller than the search value
+  ValueID lower_bound(const std::string& value) const;
+
+  // same as lower_bound(T), but accepts an AllTypeVariant
+  ValueID lower_bound(const AllTypeVariant& value) const override;
+
+  // returns the first value ID that refers to a value > the search value
+  // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
+  ValueID upper_bound(const std::string& value) const;
+
+  // same as upper_bound(T), but accepts an AllTypeVariant
+  ValueID upper_bound(const AllTypeVariant& value) const override;
+
+  // return the number of unique_values (dictionary entries)
+  size_t unique_values_count() const override;
+
+  // return the number of entries
+  size_t size() const override;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::shared_ptr<const FrontCodedDictionary> _dictionary;
+  std::shared_ptr<const BaseAttributeVector> _attribute_vector;
+};
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#include "group_key_index.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "base_dictionary_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the number of value ids that are decoded at once while building the index
+constexpr size_t decode_block_size = 1024;
+
+}  // namespace
+
+GroupKeyIndex::GroupKeyIndex(const std::shared_ptr<const BaseSegment>& indexed_segment)
+    : BaseIndex(SegmentIndexType::GroupKey, indexed_segment),
+      _dictionary_segment(std::dynamic_pointer_cast<const BaseDictionarySegment>(indexed_segment)) {
+  Assert(_dictionary_segment, "GroupKeyIndex requires a dictionary-encoded segment.");
+
+  const auto& attribute_vector = *_dictionary_segment->attribute_vector();
+  const auto size = attribute_vector.size();
+  const auto unique_values_count = _dictionary_segment->unique_values_count();
+
+  // a counting sort: count the rows per value id, turn the counts into start offsets and then place each row
+  _value_start_offsets.resize(unique_values_count + 1);
+  auto value_ids = std::array<ValueID, decode_block_size>{};
+  for (auto block_begin = size_t{0}; block_begin < size; block_begin += decode_block_size) {
+    const auto block_length = std::min(decode_block_size, size - block_begin);
+    attribute_vector.decode(block_begin, block_length, value_ids.data());
+    for (auto index = size_t{0}; index < block_length; ++index) ++_value_start_offsets[value_ids[index] + 1];
+  }
+  for (auto value_id = size_t{1}; value_id <= unique_values_count; ++value_id) {
+    _value_start_offsets[value_id] += _value_start_offsets[value_id - 1];
+  }
+
+  _positions.resize(size);
+  auto next_offsets = std::vector<ChunkOffset>(_value_start_offsets.cbegin(), _value_start_offsets.cend() - 1);
+  for (auto block_begin = size_t{0}; block_begin < size; block_begin += decode_block_size) {
+    const auto block_length = std::min(decode_block_size, size - block_begin);
+    attribute_vector.decode(block_begin, block_length, value_ids.data());
+    for (auto index = size_t{0}; index < block_length; ++index) {
+      _positions[next_offsets[value_ids[index]]++] = static_cast<ChunkOffset>(block_begin + index);
+    }
+  }
+}
+
+void GroupKeyIndex::range_lookup(const IndexBound& lower, const IndexBound& upper,
+                                 std::vector<ChunkOffset>& matches) const {
+  const auto begin_value_id = _lower_value_id(lower);
+  const auto end_value_id = _upper_value_id(upper);
+  if (begin_value_id >= end_value_id) return;
+
+  matches.insert(matches.end(), _positions.cbegin() + _value_start_offsets[begin_value_id],
+                 _positions.cbegin() + _value_start_offsets[end_value_id]);
+}
+
+ValueID GroupKeyIndex::_lower_value_id(const IndexBound& lower) const {
+  if (!lower.value) return ValueID{0};
+  const auto value_id = lower.is_inclusive ? _dictionary_segment->lower_bound(*lower.value)
+                                           : _dictionary_segment->upper_bound(*lower.value);
+  return value_id == INVALID_VALUE_ID ? ValueID{static_cast<uint32_t>(_dictionary_segment->unique_values_count())}
+                                      : value_id;
+}
+
+ValueID GroupKeyIndex::_upper_value_id(const IndexBound& upper) const {
+  const auto unique_values_count = ValueID{static_cast<uint32_t>(_dictionary_segment->unique_values_count())};
+  if (!upper.value) return unique_values_count;
+  const auto value_id = upper.is_inclusive ? _dictionary_segment->upper_bound(*upper.value)
+                                           : _dictionary_segment->lower_bound(*upper.value);
+  return value_id == INVALID_VALUE_ID ? unique_values_count : value_id;
+}
+
+const std::vector<ChunkOffset>& GroupKeyIndex::value_start_offsets() const { return _value_start_offsets; }
+
+const std::vector<ChunkOffset>& GroupKeyIndex::positions() const { return _positions; }
+
+size_t GroupKeyIndex::estimate_memory_usage() const {
+  return (_value_start_offsets.size() + _positions.size()) * sizeof(ChunkOffset);
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+
+// GroupKeyIndex is an index over a dictionary-encoded segment. It groups the chunk offsets of the segment by value id:
+// `_positions` holds all chunk offsets sorted by their value id, and `_value_start_offsets[value_id]` is the index
+// into `_positions` of the first row with that value id. Since value ids are ordered like their values, a lookup
+// translates its bounds into a range of value ids and returns a contiguous part of `_positions`, without reading the
+// attribute vector.
+class GroupKeyIndex : public BaseIndex {
+ public:
+  explicit GroupKeyIndex(const std::shared_ptr<const BaseSegment>& indexed_segment);
+
+  void range_lookup(const IndexBound& lower, const IndexBound& upper,
+                    std::vector<ChunkOffset>& matches) const override;
+
+  // returns the index into positions() of the first row of each value id, followed by the number of rows
+  const std::vector<ChunkOffset>& value_start_offsets() const;
+
+  // returns the chunk offsets of all rows, sorted by value id
+  const std::vector<ChunkOffset>& positions() const;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  // returns the value id at which a range with the given lower or upper bound begins or ends
+  ValueID _lower_value_id(const IndexBound& lower) const;
+  ValueID _upper_value_id(const IndexBound& upper) const;
+
+  std::shared_ptr<const BaseDictionarySegment> _dictionary_segment;
+  std::vector<ChunkOffset> _value_start_offsets;
+  std::vector<ChunkOffset> _positions;
+};
+
+}  // namespace opossum
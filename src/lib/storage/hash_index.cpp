@@ -0,0 +1,84 @@
+#include "hash_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "chunk.hpp"
+#include "segment_iterators.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+HashIndex<T>::HashIndex(const std::shared_ptr<const BaseSegment>& indexed_segment)
+    : BaseIndex(SegmentIndexType::Hash, indexed_segment) {
+  segment_with_iterators<T>(*indexed_segment, [&](auto it, const auto end) {
+    for (; it != end; ++it) {
+      const auto& position = *it;
+      _hash_table.insert(position.value(), position.chunk_offset());
+    }
+  });
+}
+
+template <typename T>
+void HashIndex<T>::range_lookup(const IndexBound& /*lower*/, const IndexBound& /*upper*/,
+                                std::vector<ChunkOffset>& /*matches*/) const {
+  Fail("HashIndex only supports equality lookups.");
+}
+
+template <typename T>
+void HashIndex<T>::point_lookup(const AllTypeVariant& value, std::vector<ChunkOffset>& matches) const {
+  _hash_table.lookup(type_cast<T>(value), matches);
+}
+
+template <typename T>
+void HashIndex<T>::insert(const AllTypeVariant& value, const ChunkOffset chunk_offset) {
+  _hash_table.insert(type_cast<T>(value), chunk_offset);
+}
+
+template <typename T>
+bool HashIndex<T>::supports_range_lookups() const {
+  return false;
+}
+
+template <typename T>
+size_t HashIndex<T>::estimate_memory_usage() const {
+  return _hash_table.estimate_memory_usage();
+}
+
+BaseTableHashIndex::BaseTableHashIndex(const ColumnID column_id) : _column_id(column_id) {}
+
+ColumnID BaseTableHashIndex::column_id() const { return _column_id; }
+
+template <typename T>
+void TableHashIndex<T>::insert_chunk(const Chunk& chunk, const ChunkID chunk_id) {
+  segment_with_iterators<T>(*chunk.get_segment(_column_id), [&](auto it, const auto end) {
+    for (; it != end; ++it) {
+      const auto& position = *it;
+      _hash_table.insert(position.value(), RowID{chunk_id, position.chunk_offset()});
+    }
+  });
+}
+
+template <typename T>
+void TableHashIndex<T>::insert(const AllTypeVariant& value, const RowID row_id) {
+  _hash_table.insert(type_cast<T>(value), row_id);
+}
+
+template <typename T>
+std::shared_ptr<PosList> TableHashIndex<T>::point_lookup(const AllTypeVariant& value) const {
+  auto pos_list = std::make_shared<PosList>();
+  _hash_table.lookup(type_cast<T>(value), *pos_list);
+  return pos_list;
+}
+
+template <typename T>
+size_t TableHashIndex<T>::estimate_memory_usage() const {
+  return _hash_table.estimate_memory_usage();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(HashIndex);
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableHashIndex);
+
+}  // namespace opossum
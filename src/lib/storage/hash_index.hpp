@@ -0,0 +1,218 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_index.hpp"
+#include "bloom_filter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// HashTable maps values to the positions of the rows that hold them, using open addressing. Each bucket fills one
+// cache line with the fingerprints and ids of eight distinct values, so that a probe usually reads a single cache line
+// and compares only values whose fingerprint matches. Full buckets overflow into the next one. The positions of each
+// value are chained in insertion order.
+template <typename T, typename Position>
+class HashTable : private Noncopyable {
+ public:
+  HashTable() : _buckets(1) {}
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  HashTable(HashTable&&) = default;
+  HashTable& operator=(HashTable&&) = default;
+
+  void insert(const T& value, const Position position) {
+    const auto hash = BloomFilter::hash(value);
+    auto value_id = _find(value, hash);
+    if (value_id == invalid_id) {
+      if (_values.size() + 1 > _buckets.size() * max_values_per_bucket) _grow();
+      value_id = static_cast<uint32_t>(_values.size());
+      _values.push_back(value);
+      _first_entries.push_back(invalid_id);
+      _last_entries.push_back(invalid_id);
+      _place(value_id, hash);
+    }
+
+    const auto entry = static_cast<uint32_t>(_positions.size());
+    _positions.push_back(position);
+    _next_entries.push_back(invalid_id);
+    if (_last_entries[value_id] == invalid_id) {
+      _first_entries[value_id] = entry;
+    } else {
+      _next_entries[_last_entries[value_id]] = entry;
+    }
+    _last_entries[value_id] = entry;
+  }
+
+  // appends the positions of all rows that hold the given value, in insertion order
+  void lookup(const T& value, std::vector<Position>& matches) const {
+    const auto value_id = _find(value, BloomFilter::hash(value));
+    if (value_id == invalid_id) return;
+    for (auto entry = _first_entries[value_id]; entry != invalid_id; entry = _next_entries[entry]) {
+      matches.push_back(_positions[entry]);
+    }
+  }
+
+  // returns the number of positions
+  size_t size() const { return _positions.size(); }
+
+  // returns the number of distinct values
+  size_t value_count() const { return _values.size(); }
+
+  size_t bucket_count() const { return _buckets.size(); }
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const {
+    auto memory_usage = _buckets.capacity() * sizeof(Bucket) + _values.capacity() * sizeof(T) +
+                        (_first_entries.capacity() + _last_entries.capacity() + _next_entries.capacity()) *
+                            sizeof(uint32_t) +
+                        _positions.capacity() * sizeof(Position);
+    if constexpr (std::is_same_v<T, std::string>) {
+      for (const auto& value : _values) memory_usage += value.capacity();
+    }
+    return memory_usage;
+  }
+
+ protected:
+  static constexpr auto invalid_id = std::numeric_limits<uint32_t>::max();
+  static constexpr size_t slots_per_bucket = 8;
+
+  // buckets are kept at most three quarters full, so that most probes end in the first bucket
+  static constexpr size_t max_values_per_bucket = slots_per_bucket * 3 / 4;
+
+  struct alignas(64) Bucket {
+    std::array<uint32_t, slots_per_bucket> fingerprints{};
+    std::array<uint32_t, slots_per_bucket> value_ids{invalid_id, invalid_id, invalid_id, invalid_id,
+                                                     invalid_id, invalid_id, invalid_id, invalid_id};
+  };
+  static_assert(sizeof(Bucket) == 64, "A bucket has to fill exactly one cache line.");
+
+  // the lower half of the hash selects the bucket, the upper half is the fingerprint
+  size_t _bucket_index(const uint64_t hash) const { return static_cast<size_t>(hash) & (_buckets.size() - 1); }
+
+  static uint32_t _fingerprint(const uint64_t hash) { return static_cast<uint32_t>(hash >> 32); }
+
+  // returns the id of the value, or invalid_id if it is not in the table
+  uint32_t _find(const T& value, const uint64_t hash) const {
+    const auto fingerprint = _fingerprint(hash);
+    for (auto bucket_index = _bucket_index(hash);; bucket_index = (bucket_index + 1) & (_buckets.size() - 1)) {
+      const auto& bucket = _buckets[bucket_index];
+      for (auto slot = size_t{0}; slot < slots_per_bucket; ++slot) {
+        const auto value_id = bucket.value_ids[slot];
+        if (value_id == invalid_id) return invalid_id;
+        if (bucket.fingerprints[slot] == fingerprint && _values[value_id] == value) return value_id;
+      }
+    }
+  }
+
+  // stores the id of a value that is not in the table yet in the first free slot
+  void _place(const uint32_t value_id, const uint64_t hash) {
+    for (auto bucket_index = _bucket_index(hash);; bucket_index = (bucket_index + 1) & (_buckets.size() - 1)) {
+      auto& bucket = _buckets[bucket_index];
+      for (auto slot = size_t{0}; slot < slots_per_bucket; ++slot) {
+        if (bucket.value_ids[slot] != invalid_id) continue;
+        bucket.fingerprints[slot] = _fingerprint(hash);
+        bucket.value_ids[slot] = value_id;
+        return;
+      }
+    }
+  }
+
+  // doubles the number of buckets and places all values anew
+  void _grow() {
+    _buckets = std::vector<Bucket>(_buckets.size() * 2);
+    for (auto value_id = uint32_t{0}; value_id < _values.size(); ++value_id) {
+      _place(value_id, BloomFilter::hash(_values[value_id]));
+    }
+  }
+
+  std::vector<Bucket> _buckets;
+  std::vector<T> _values;
+  std::vector<uint32_t> _first_entries;
+  std::vector<uint32_t> _last_entries;
+  std::vector<uint32_t> _next_entries;
+  std::vector<Position> _positions;
+};
+
+// HashIndex indexes a segment of any encoding with a HashTable. It answers equality lookups in constant time, but
+// cannot answer range lookups. Rows that are appended to the chunk are added to it.
+template <typename T>
+class HashIndex : public BaseIndex {
+ public:
+  explicit HashIndex(const std::shared_ptr<const BaseSegment>& indexed_segment);
+
+  void range_lookup(const IndexBound& lower, const IndexBound& upper,
+                    std::vector<ChunkOffset>& matches) const override;
+
+  void point_lookup(const AllTypeVariant& value, std::vector<ChunkOffset>& matches) const override;
+
+  void insert(const AllTypeVariant& value, const ChunkOffset chunk_offset) override;
+
+  bool supports_range_lookups() const override;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  HashTable<T, ChunkOffset> _hash_table;
+};
+
+// BaseTableHashIndex is the abstract super class of hash indexes over a column of a whole table, which map values to
+// RowIDs, so that a lookup does not have to probe every chunk.
+//
+// Indexes are created and maintained by tables, see Table::create_hash_index.
+class BaseTableHashIndex : private Noncopyable {
+ public:
+  explicit BaseTableHashIndex(const ColumnID column_id);
+  virtual ~BaseTableHashIndex() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BaseTableHashIndex(BaseTableHashIndex&&) = default;
+  BaseTableHashIndex& operator=(BaseTableHashIndex&&) = default;
+
+  ColumnID column_id() const;
+
+  // adds all rows of a chunk of the table
+  virtual void insert_chunk(const Chunk& chunk, const ChunkID chunk_id) = 0;
+
+  // adds a row, given as its value in the indexed column
+  virtual void insert(const AllTypeVariant& value, const RowID row_id) = 0;
+
+  // returns the positions of all rows that hold the given value, in insertion order
+  virtual std::shared_ptr<PosList> point_lookup(const AllTypeVariant& value) const = 0;
+
+  // returns the calculated memory usage
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  ColumnID _column_id;
+};
+
+template <typename T>
+class TableHashIndex : public BaseTableHashIndex {
+ public:
+  using BaseTableHashIndex::BaseTableHashIndex;
+
+  void insert_chunk(const Chunk& chunk, const ChunkID chunk_id) override;
+
+  void insert(const AllTypeVariant& value, const RowID row_id) override;
+
+  std::shared_ptr<PosList> point_lookup(const AllTypeVariant& value) const override;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  HashTable<T, RowID> _hash_table;
+};
+
+}  // namespace opossum
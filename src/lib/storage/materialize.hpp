@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "delta_segment.hpp"
+#include "dictionary_segment.hpp"
+#include "reference_segment.hpp"
+#include "run_length_segment.hpp"
+#include "segment_iterators.hpp"
+#include "types.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+/**
+ * Appends the values of a segment of data type T to `out`: all of them if `chunk_offsets` is nullptr, otherwise only
+ * those at the given offsets, in the given order. Operators use this to pull the values of a whole segment at once
+ * instead of calling operator[] for every row.
+ *
+ * The segment type is resolved once per call:
+ *  - ValueSegments are copied with a single insert, or gathered by offset.
+ *  - DictionarySegments decode their attribute vector block by block and look the value ids up in the dictionary.
+ *  - RunLengthSegments and DeltaSegments are expanded run by run or block by block.
+ *  - ReferenceSegments sort their positions by chunk and offset, gather the values of each referenced segment with
+ *    one call, and put them back into the order of the position list.
+ *  - All other segment types are read through segment_with_iterators.
+ */
+template <typename T>
+void materialize_values(const BaseSegment& segment, std::vector<T>& out,
+                        const std::vector<ChunkOffset>* chunk_offsets = nullptr);
+
+namespace detail {
+
+// the number of value ids that a DictionarySegment decodes at once
+constexpr size_t materialize_block_size = 1024;
+
+template <typename T>
+void materialize_dictionary_segment(const DictionarySegment<T>& segment, std::vector<T>& out) {
+  const auto& dictionary = *segment.dictionary();
+  const auto& attribute_vector = *segment.attribute_vector();
+  const auto size = attribute_vector.size();
+
+  auto value_ids = std::array<ValueID, materialize_block_size>{};
+  for (auto block_begin = size_t{0}; block_begin < size; block_begin += materialize_block_size) {
+    const auto block_length = std::min(materialize_block_size, size - block_begin);
+    attribute_vector.decode(block_begin, block_length, value_ids.data());
+    for (auto index = size_t{0}; index < block_length; ++index) {
+      out.push_back(dictionary[value_ids[index]]);
+    }
+  }
+}
+
+template <typename T>
+void materialize_run_length_segment(const RunLengthSegment<T>& segment, std::vector<T>& out) {
+  const auto& values = *segment.values();
+  const auto& end_positions = *segment.end_positions();
+
+  auto run_begin = size_t{0};
+  for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+    const auto run_end = size_t{end_positions[run_index]} + 1;
+    out.insert(out.end(), run_end - run_begin, values[run_index]);
+    run_begin = run_end;
+  }
+}
+
+template <typename T>
+void materialize_delta_segment(const DeltaSegment<T>& segment, std::vector<T>& out) {
+  const auto size = segment.size();
+  const auto out_begin = out.size();
+  // decode_block writes whole blocks, so the last one may need room beyond the segment's size
+  out.resize(out_begin + segment.block_count() * DeltaSegment<T>::block_size);
+  for (auto block_index = size_t{0}; block_index < segment.block_count(); ++block_index) {
+    segment.decode_block(block_index, out.data() + out_begin + block_index * DeltaSegment<T>::block_size);
+  }
+  out.resize(out_begin + size);
+}
+
+template <typename T>
+void materialize_reference_segment(const ReferenceSegment& segment, std::vector<T>& out,
+                                   const std::vector<ChunkOffset>* chunk_offsets) {
+  const auto& pos_list = *segment.pos_list();
+  const auto& referenced_table = *segment.referenced_table();
+  const auto column_id = segment.referenced_column_id();
+
+  const auto row_count = chunk_offsets ? chunk_offsets->size() : pos_list.size();
+  const auto row_id = [&](const size_t index) -> const RowID& {
+    return chunk_offsets ? pos_list[(*chunk_offsets)[index]] : pos_list[index];
+  };
+  if (row_count == 0) return;
+
+  // positions that all point into one chunk, which is what scans produce, are gathered directly
+  const auto first_chunk_id = row_id(0).chunk_id;
+  auto single_chunk = true;
+  for (auto index = size_t{1}; index < row_count && single_chunk; ++index) {
+    single_chunk = row_id(index).chunk_id == first_chunk_id;
+  }
+  if (single_chunk) {
+    auto referenced_offsets = std::vector<ChunkOffset>(row_count);
+    for (auto index = size_t{0}; index < row_count; ++index) referenced_offsets[index] = row_id(index).chunk_offset;
+    const auto& referenced_segment = *referenced_table.get_chunk(first_chunk_id).get_segment(column_id);
+    materialize_values(referenced_segment, out, &referenced_offsets);
+    return;
+  }
+
+  // otherwise, the rows are visited sorted by chunk and offset, so that each referenced segment is read once and in
+  // order, and the values are scattered back to where they belong
+  auto order = std::vector<size_t>(row_count);
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::stable_sort(order.begin(), order.end(),
+                   [&](const size_t lhs, const size_t rhs) { return row_id(lhs) < row_id(rhs); });
+
+  const auto out_begin = out.size();
+  out.resize(out_begin + row_count);
+  auto referenced_offsets = std::vector<ChunkOffset>{};
+  auto gathered_values = std::vector<T>{};
+
+  auto group_begin = size_t{0};
+  while (group_begin < row_count) {
+    const auto chunk_id = row_id(order[group_begin]).chunk_id;
+    auto group_end = group_begin;
+    referenced_offsets.clear();
+    while (group_end < row_count && row_id(order[group_end]).chunk_id == chunk_id) {
+      referenced_offsets.push_back(row_id(order[group_end]).chunk_offset);
+      ++group_end;
+    }
+
+    gathered_values.clear();
+    const auto& referenced_segment = *referenced_table.get_chunk(chunk_id).get_segment(column_id);
+    materialize_values(referenced_segment, gathered_values, &referenced_offsets);
+    for (auto index = group_begin; index < group_end; ++index) {
+      out[out_begin + order[index]] = std::move(gathered_values[index - group_begin]);
+    }
+    group_begin = group_end;
+  }
+}
+
+}  // namespace detail
+
+template <typename T>
+void materialize_values(const BaseSegment& segment, std::vector<T>& out,
+                        const std::vector<ChunkOffset>* chunk_offsets) {
+  if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    detail::materialize_reference_segment(*reference_segment, out, chunk_offsets);
+    return;
+  }
+
+  if (chunk_offsets) {
+    out.reserve(out.size() + chunk_offsets->size());
+    with_segment_accessor<T>(segment, [&](const auto& accessor) {
+      for (const auto chunk_offset : *chunk_offsets) out.push_back(accessor(chunk_offset));
+    });
+    return;
+  }
+
+  out.reserve(out.size() + segment.size());
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    out.insert(out.end(), value_segment->values().cbegin(), value_segment->values().cend());
+  } else if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    detail::materialize_dictionary_segment(*dictionary_segment, out);
+  } else if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    detail::materialize_run_length_segment(*run_length_segment, out);
+  } else {
+    if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+      if (const auto* delta_segment = dynamic_cast<const DeltaSegment<T>*>(&segment)) {
+        detail::materialize_delta_segment(*delta_segment, out);
+        return;
+      }
+    }
+    segment_with_iterators<T>(segment, [&](auto it, const auto end) {
+      for (; it != end; ++it) out.push_back((*it).value());
+    });
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is a specific segment type that stores each run of equal consecutive values only once, together
+// with the chunk offset of the run's last value. Sorted or clustered columns shrink by orders of magnitude.
+template <typename T>
+class RunLengthSegment : public BaseSegment {
+ public:
+  /**
+   * Creates a RunLength segment from a given value segment.
+   */
+  explicit RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment)
+      : _values(std::make_shared<std::vector<T>>()), _end_positions(std::make_shared<std::vector<ChunkOffset>>()) {
+    const auto value_segment = std::static_pointer_cast<ValueSegment<T>>(base_segment);
+    const auto& values = value_segment->values();
+
+    for (auto position = ChunkOffset{0}; position < values.size(); ++position) {
+      if (position == 0 || values[position] != _values->back()) {
+        _values->push_back(values[position]);
+        _end_positions->push_back(position);
+      } else {
+        _end_positions->back() = position;
+      }
+    }
+
+    _values->shrink_to_fit();
+    _end_positions->shrink_to_fit();
+  }
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override { return get(chunk_offset); }
+
+  // return the value at a certain position. This needs a binary search over the runs.
+  const T& get(const ChunkOffset chunk_offset) const { return (*_values)[run_index(chunk_offset)]; }
+
+  // returns the index of the run that contains the given position
+  size_t run_index(const ChunkOffset chunk_offset) const {
+    DebugAssert(chunk_offset < size(), "chunk_offset is out of range.");
+    const auto run_it = std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), chunk_offset);
+    return static_cast<size_t>(run_it - _end_positions->cbegin());
+  }
+
+  // run-length segments are immutable
+  void append(const AllTypeVariant&) override { throw std::runtime_error("RunLength segments are immutable."); }
+
+  // returns the value of each run
+  std::shared_ptr<const std::vector<T>> values() const { return _values; }
+
+  // returns the chunk offset of the last value of each run
+  std::shared_ptr<const std::vector<ChunkOffset>> end_positions() const { return _end_positions; }
+
+  // return the number of runs
+  size_t run_count() const { return _values->size(); }
+
+  // return the number of entries
+  size_t size() const override { return _end_positions->empty() ? 0 : _end_positions->back() + 1; }
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final {
+    return _values->size() * sizeof(T) + _end_positions->size() * sizeof(ChunkOffset);
+  }
+
+ protected:
+  std::shared_ptr<std::vector<T>> _values;
+  std::shared_ptr<std::vector<ChunkOffset>> _end_positions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,145 @@
+#include "segment_encoding_utils.hpp"
+
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "delta_segment.hpp"
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "front_coded_dictionary_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "simd_bp128_attribute_vector.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+AttributeVectorEncoding attribute_vector_encoding_of(
+    const std::shared_ptr<const BaseAttributeVector>& attribute_vector) {
+  if (std::dynamic_pointer_cast<const BitPackedAttributeVector>(attribute_vector)) {
+    return AttributeVectorEncoding::BitPacked;
+  }
+  if (std::dynamic_pointer_cast<const SimdBp128AttributeVector>(attribute_vector)) {
+    return AttributeVectorEncoding::SimdBp128;
+  }
+  return AttributeVectorEncoding::FixedSize;
+}
+
+bool is_value_segment(const std::string& type, const std::shared_ptr<BaseSegment>& segment) {
+  auto is_value_segment = false;
+  resolve_data_type(type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    is_value_segment = static_cast<bool>(std::dynamic_pointer_cast<const ValueSegment<Type>>(segment));
+  });
+  return is_value_segment;
+}
+
+}  // namespace
+
+bool is_encoding_supported(const std::string& type, const EncodingType encoding_type) {
+  switch (encoding_type) {
+    case EncodingType::Dictionary:
+    case EncodingType::RunLength:
+      return true;
+    case EncodingType::FrameOfReference:
+    case EncodingType::Delta:
+      return type == "int" || type == "long";
+    case EncodingType::FrontCodedDictionary:
+      return type == "string";
+  }
+  return false;
+}
+
+bool can_encode_values(const std::string& type, const std::shared_ptr<BaseSegment>& value_segment,
+                       const SegmentEncodingSpec& spec) {
+  Assert(is_value_segment(type, value_segment), "Only ValueSegments can be encoded.");
+  if (!is_encoding_supported(type, spec.encoding_type)) return false;
+  if (spec.encoding_type != EncodingType::FrameOfReference) return true;
+
+  auto fits = false;
+  resolve_data_type(type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    if constexpr (std::is_integral_v<Type>) {
+      const auto& values = std::dynamic_pointer_cast<const ValueSegment<Type>>(value_segment)->values();
+      fits = FrameOfReferenceSegment<Type>::max_block_range(values) <= std::numeric_limits<uint32_t>::max();
+    }
+  });
+  return fits;
+}
+
+std::shared_ptr<BaseSegment> encode_segment(const std::string& type, const std::shared_ptr<BaseSegment>& value_segment,
+                                            const SegmentEncodingSpec& spec) {
+  Assert(is_value_segment(type, value_segment), "Only ValueSegments can be encoded.");
+  switch (spec.encoding_type) {
+    case EncodingType::Dictionary:
+      return make_shared_by_data_type<BaseSegment, DictionarySegment>(type, value_segment,
+                                                                      spec.attribute_vector_encoding);
+    case EncodingType::RunLength:
+      return make_shared_by_data_type<BaseSegment, RunLengthSegment>(type, value_segment);
+    case EncodingType::FrameOfReference: {
+      auto segment = std::shared_ptr<BaseSegment>{};
+      resolve_data_type(type, [&](auto type) {
+        using Type = typename decltype(type)::type;
+        if constexpr (std::is_integral_v<Type>) {
+          segment = std::make_shared<FrameOfReferenceSegment<Type>>(value_segment);
+        } else {
+          Fail("FrameOfReference encoding is only supported for int and long columns.");
+        }
+      });
+      return segment;
+    }
+    case EncodingType::Delta: {
+      auto segment = std::shared_ptr<BaseSegment>{};
+      resolve_data_type(type, [&](auto type) {
+        using Type = typename decltype(type)::type;
+        if constexpr (std::is_integral_v<Type>) {
+          segment = std::make_shared<DeltaSegment<Type>>(value_segment);
+        } else {
+          Fail("Delta encoding is only supported for int and long columns.");
+        }
+      });
+      return segment;
+    }
+    case EncodingType::FrontCodedDictionary:
+      Assert(type == "string", "FrontCodedDictionary encoding is only supported for string columns.");
+      return std::make_shared<FrontCodedDictionarySegment>(value_segment, spec.attribute_vector_encoding);
+  }
+  Fail("Unknown encoding type.");
+  return nullptr;
+}
+
+std::optional<SegmentEncodingSpec> encoding_spec_of(const std::string& type,
+                                                    const std::shared_ptr<const BaseSegment>& segment) {
+  if (const auto front_coded_segment = std::dynamic_pointer_cast<const FrontCodedDictionarySegment>(segment)) {
+    return SegmentEncodingSpec{EncodingType::FrontCodedDictionary,
+                               attribute_vector_encoding_of(front_coded_segment->attribute_vector())};
+  }
+
+  auto spec = std::optional<SegmentEncodingSpec>{};
+  resolve_data_type(type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<Type>>(segment)) {
+      spec = SegmentEncodingSpec{EncodingType::Dictionary,
+                                 attribute_vector_encoding_of(dictionary_segment->attribute_vector())};
+    } else if (std::dynamic_pointer_cast<const RunLengthSegment<Type>>(segment)) {
+      spec = SegmentEncodingSpec{EncodingType::RunLength};
+    }
+    if constexpr (std::is_integral_v<Type>) {
+      if (std::dynamic_pointer_cast<const FrameOfReferenceSegment<Type>>(segment)) {
+        spec = SegmentEncodingSpec{EncodingType::FrameOfReference};
+      } else if (std::dynamic_pointer_cast<const DeltaSegment<Type>>(segment)) {
+        spec = SegmentEncodingSpec{EncodingType::Delta};
+      }
+    }
+  });
+  return spec;
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "encoding_type.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// returns whether segments of the given data type can be encoded with `encoding_type`
+bool is_encoding_supported(const std::string& type, const EncodingType encoding_type);
+
+// returns whether the values of a ValueSegment of the given data type can be encoded as described by `spec`, which is
+// not the case for FrameOfReference if the value range of a block does not fit into 32 bits. Throws if the segment is
+// not a ValueSegment, e.g., because the chunk is already compressed.
+bool can_encode_values(const std::string& type, const std::shared_ptr<BaseSegment>& value_segment,
+                       const SegmentEncodingSpec& spec);
+
+// Turns a ValueSegment of the given data type into a segment of the encoding described by `spec`
+std::shared_ptr<BaseSegment> encode_segment(const std::string& type, const std::shared_ptr<BaseSegment>& value_segment,
+                                            const SegmentEncodingSpec& spec);
+
+// returns the spec that a segment of the given data type was encoded with, or std::nullopt if it is not encoded,
+// e.g., because it is a ValueSegment
+std::optional<SegmentEncodingSpec> encoding_spec_of(const std::string& type,
+                                                    const std::shared_ptr<const BaseSegment>& segment);
+
+}  // namespace opossum
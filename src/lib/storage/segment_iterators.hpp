@@ -0,0 +1,235 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "cold_segment.hpp"
+#include "dictionary_segment.hpp"
+#include "fixed_size_attribute_vector.hpp"
+#include "reference_segment.hpp"
+#include "simd_bp128_attribute_vector.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+/**
+ * Typed iteration over segments without constructing an AllTypeVariant per value and without a virtual call per row.
+ *
+ * segment_with_iterators<T>(segment, functor) finds out the concrete type of the segment once and then calls the
+ * functor with a begin and an end iterator that are specialized for it. The functor therefore has to be a generic
+ * lambda. Dereferencing an iterator yields a SegmentPosition with the value and its offset in the iterated segment.
+ *
+ * Example:
+ *   segment_with_iterators<int>(segment, [&](auto it, const auto end) {
+ *     for (; it != end; ++it) {
+ *       const auto position = *it;
+ *       if (position.value() > 5) matches.push_back(position.chunk_offset());
+ *     }
+ *   });
+ *
+ * The functor is called once per segment, except for ReferenceSegments whose positions point into several chunks: to
+ * keep the iterators specialized, it is then called once for each run of positions that point into the same chunk,
+ * in the order of the position list. ValueSegments and DictionarySegments (with any attribute vector) have
+ * specialized iterators, so do ReferenceSegments that reference them and ColdSegments that rebuild them. Other segment
+ * types are accessed through operator[].
+ */
+
+// a value and the offset at which it is found. The value is only valid until the iterator is advanced.
+template <typename T>
+class SegmentPosition {
+ public:
+  SegmentPosition(const T& value, const ChunkOffset chunk_offset) : _value(value), _chunk_offset(chunk_offset) {}
+
+  const T& value() const { return _value; }
+  ChunkOffset chunk_offset() const { return _chunk_offset; }
+
+ protected:
+  const T& _value;
+  const ChunkOffset _chunk_offset;
+};
+
+// Accessors return the value at a given offset of a segment with a non-virtual call.
+template <typename T>
+class ValueSegmentAccessor {
+ public:
+  explicit ValueSegmentAccessor(const ValueSegment<T>& segment) : _values(segment.values().data()) {}
+
+  const T& operator()(const ChunkOffset chunk_offset) const { return _values[chunk_offset]; }
+
+ protected:
+  const T* _values;
+};
+
+template <typename T, typename AttributeVector>
+class DictionarySegmentAccessor {
+ public:
+  DictionarySegmentAccessor(const DictionarySegment<T>& segment, const AttributeVector& attribute_vector)
+      : _dictionary(segment.dictionary()->data()), _attribute_vector(&attribute_vector) {}
+
+  // the attribute vector types are final, so that get() is not called virtually
+  const T& operator()(const ChunkOffset chunk_offset) const {
+    return _dictionary[_attribute_vector->get(chunk_offset)];
+  }
+
+ protected:
+  const T* _dictionary;
+  const AttributeVector* _attribute_vector;
+};
+
+// fallback for all other segment types
+template <typename T>
+class GenericSegmentAccessor {
+ public:
+  explicit GenericSegmentAccessor(const BaseSegment& segment) : _segment(&segment) {}
+
+  const T& operator()(const ChunkOffset chunk_offset) const {
+    _value = type_cast<T>((*_segment)[chunk_offset]);
+    return _value;
+  }
+
+ protected:
+  const BaseSegment* _segment;
+  mutable T _value{};
+};
+
+// iterates over offsets begin..end of a segment
+template <typename T, typename Accessor>
+class SequentialSegmentIterator
+    : public boost::iterator_facade<SequentialSegmentIterator<T, Accessor>, SegmentPosition<T>,
+                                    boost::random_access_traversal_tag, SegmentPosition<T>> {
+ public:
+  SequentialSegmentIterator(const Accessor& accessor, const ChunkOffset chunk_offset)
+      : _accessor(accessor), _chunk_offset(chunk_offset) {}
+
+ private:
+  friend class boost::iterator_core_access;
+
+  void increment() { ++_chunk_offset; }
+  void decrement() { --_chunk_offset; }
+  void advance(const std::ptrdiff_t n) { _chunk_offset += n; }
+  bool equal(const SequentialSegmentIterator& other) const { return _chunk_offset == other._chunk_offset; }
+  std::ptrdiff_t distance_to(const SequentialSegmentIterator& other) const {
+    return std::ptrdiff_t{other._chunk_offset} - std::ptrdiff_t{_chunk_offset};
+  }
+  SegmentPosition<T> dereference() const { return {_accessor(_chunk_offset), _chunk_offset}; }
+
+  Accessor _accessor;
+  ChunkOffset _chunk_offset;
+};
+
+// iterates over the segment positions referenced by a range of a position list. The offsets of the SegmentPositions
+// are those in the position list.
+template <typename T, typename Accessor>
+class PointAccessSegmentIterator
+    : public boost::iterator_facade<PointAccessSegmentIterator<T, Accessor>, SegmentPosition<T>,
+                                    boost::random_access_traversal_tag, SegmentPosition<T>> {
+ public:
+  PointAccessSegmentIterator(const Accessor& accessor, const RowID* row_ids, const ChunkOffset chunk_offset)
+      : _accessor(accessor), _row_ids(row_ids), _chunk_offset(chunk_offset) {}
+
+ private:
+  friend class boost::iterator_core_access;
+
+  void increment() { ++_chunk_offset; }
+  void decrement() { --_chunk_offset; }
+  void advance(const std::ptrdiff_t n) { _chunk_offset += n; }
+  bool equal(const PointAccessSegmentIterator& other) const { return _chunk_offset == other._chunk_offset; }
+  std::ptrdiff_t distance_to(const PointAccessSegmentIterator& other) const {
+    return std::ptrdiff_t{other._chunk_offset} - std::ptrdiff_t{_chunk_offset};
+  }
+  SegmentPosition<T> dereference() const {
+    return {_accessor(_row_ids[_chunk_offset].chunk_offset), _chunk_offset};
+  }
+
+  Accessor _accessor;
+  const RowID* _row_ids;
+  ChunkOffset _chunk_offset;
+};
+
+// calls functor(attribute_vector) with the attribute vector cast to its concrete type. All attribute vector types are
+// final, so that get() is not called virtually on the passed vector.
+template <typename Functor>
+void with_attribute_vector(const BaseAttributeVector& attribute_vector, const Functor& functor) {
+  if (const auto* fixed_size_8 = dynamic_cast<const FixedSizeAttributeVector<uint8_t>*>(&attribute_vector)) {
+    functor(*fixed_size_8);
+  } else if (const auto* fixed_size_16 = dynamic_cast<const FixedSizeAttributeVector<uint16_t>*>(&attribute_vector)) {
+    functor(*fixed_size_16);
+  } else if (const auto* fixed_size_32 = dynamic_cast<const FixedSizeAttributeVector<uint32_t>*>(&attribute_vector)) {
+    functor(*fixed_size_32);
+  } else if (const auto* bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    functor(*bit_packed);
+  } else if (const auto* simd_bp128 = dynamic_cast<const SimdBp128AttributeVector*>(&attribute_vector)) {
+    functor(*simd_bp128);
+  } else {
+    Fail("Unknown attribute vector type.");
+  }
+}
+
+// calls functor(accessor) with the accessor that matches the concrete type of the segment
+template <typename T, typename Functor>
+void with_segment_accessor(const BaseSegment& segment, const Functor& functor) {
+  // a ColdSegment is decompressed once, the rebuilt segment is kept alive while it is accessed
+  if (const auto* cold_segment = dynamic_cast<const ColdSegment*>(&segment)) {
+    const auto rebuilt_segment = cold_segment->segment();
+    with_segment_accessor<T>(*rebuilt_segment, functor);
+    return;
+  }
+
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    functor(ValueSegmentAccessor<T>{*value_segment});
+    return;
+  }
+
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    with_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      using AttributeVector = std::decay_t<decltype(attribute_vector)>;
+      functor(DictionarySegmentAccessor<T, AttributeVector>{*dictionary_segment, attribute_vector});
+    });
+    return;
+  }
+
+  functor(GenericSegmentAccessor<T>{segment});
+}
+
+// see above
+template <typename T, typename Functor>
+void segment_with_iterators(const BaseSegment& segment, const Functor& functor) {
+  const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+  if (!reference_segment) {
+    with_segment_accessor<T>(segment, [&](const auto& accessor) {
+      using Iterator = SequentialSegmentIterator<T, std::decay_t<decltype(accessor)>>;
+      functor(Iterator{accessor, 0}, Iterator{accessor, static_cast<ChunkOffset>(segment.size())});
+    });
+    return;
+  }
+
+  const auto& pos_list = *reference_segment->pos_list();
+  const auto& referenced_table = *reference_segment->referenced_table();
+  const auto column_id = reference_segment->referenced_column_id();
+
+  auto run_begin = size_t{0};
+  while (run_begin < pos_list.size()) {
+    const auto chunk_id = pos_list[run_begin].chunk_id;
+    const auto run_end = static_cast<size_t>(
+        std::find_if(pos_list.cbegin() + run_begin, pos_list.cend(),
+                     [&](const RowID& row_id) { return row_id.chunk_id != chunk_id; }) -
+        pos_list.cbegin());
+
+    const auto referenced_segment = referenced_table.get_chunk(chunk_id).get_segment(column_id);
+    with_segment_accessor<T>(*referenced_segment, [&](const auto& accessor) {
+      using Iterator = PointAccessSegmentIterator<T, std::decay_t<decltype(accessor)>>;
+      functor(Iterator{accessor, pos_list.data(), static_cast<ChunkOffset>(run_begin)},
+              Iterator{accessor, pos_list.data(), static_cast<ChunkOffset>(run_end)});
+    });
+    run_begin = run_end;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_attribute_vector.hpp"
+#include "base_segment.hpp"
+#include "bloom_filter.hpp"
+#include "dictionary_segment.hpp"
+#include "equi_depth_histogram.hpp"
+#include "front_coded_dictionary.hpp"
+#include "front_coded_dictionary_segment.hpp"
+#include "materialize.hpp"
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// BaseSegmentStatistics describes the values of a single segment of a chunk. Operators use it to find out whether a
+// chunk can contain matching rows at all without looking at the segment.
+class BaseSegmentStatistics : private Noncopyable {
+ public:
+  BaseSegmentStatistics() = default;
+  virtual ~BaseSegmentStatistics() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BaseSegmentStatistics(BaseSegmentStatistics&&) = default;
+  BaseSegmentStatistics& operator=(BaseSegmentStatistics&&) = default;
+
+  // returns the smallest and the largest value of the segment
+  virtual AllTypeVariant min() const = 0;
+  virtual AllTypeVariant max() const = 0;
+
+  // returns the number of distinct values
+  virtual size_t distinct_count() const = 0;
+
+  // returns whether the segment contains no NULL values. Since segments cannot store NULLs yet, this is always true.
+  virtual bool is_null_free() const = 0;
+
+  // returns true if no value of the segment can satisfy `value <scan_type> search_value`. A return value of false
+  // does not guarantee a match.
+  virtual bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // returns the calculated memory usage, including the histogram and the Bloom filter
+  virtual size_t estimate_memory_usage() const = 0;
+};
+
+// The statistics may contain a histogram, from which the TableStatistics are merged, and a Bloom filter over the
+// segment's values, which lets equality scans skip segments whose value range contains the search value but which do
+// not contain the value itself.
+template <typename T>
+class SegmentStatistics : public BaseSegmentStatistics {
+ public:
+  SegmentStatistics(T min, T max, const size_t distinct_count,
+                    std::shared_ptr<const EquiDepthHistogram<T>> histogram = nullptr,
+                    std::shared_ptr<const BloomFilter> bloom_filter = nullptr)
+      : _min(std::move(min)),
+        _max(std::move(max)),
+        _distinct_count(distinct_count),
+        _histogram(std::move(histogram)),
+        _bloom_filter(std::move(bloom_filter)) {}
+
+  AllTypeVariant min() const override { return _min; }
+  AllTypeVariant max() const override { return _max; }
+
+  // returns the smallest and the largest value without wrapping them into an AllTypeVariant
+  const T& typed_min() const { return _min; }
+  const T& typed_max() const { return _max; }
+
+  size_t distinct_count() const override { return _distinct_count; }
+
+  bool is_null_free() const override { return true; }
+
+  // returns the histogram of the segment's values, or nullptr if none was built
+  std::shared_ptr<const EquiDepthHistogram<T>> histogram() const { return _histogram; }
+
+  // returns the Bloom filter, or nullptr if none was built
+  std::shared_ptr<const BloomFilter> bloom_filter() const { return _bloom_filter; }
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const override {
+    return can_prune(scan_type, type_cast<T>(search_value));
+  }
+
+  // same as can_prune(ScanType, AllTypeVariant), but accepts a value of the segment's type
+  bool can_prune(const ScanType scan_type, const T& value) const {
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return value < _min || _max < value || (_bloom_filter && !_bloom_filter->may_contain(value));
+      case ScanType::OpNotEquals:
+        return _min == value && _max == value;
+      case ScanType::OpLessThan:
+        return !(_min < value);
+      case ScanType::OpLessThanEquals:
+        return value < _min;
+      case ScanType::OpGreaterThan:
+        return !(value < _max);
+      case ScanType::OpGreaterThanEquals:
+        return _max < value;
+      case ScanType::OpBetween:
+        Fail("OpBetween needs an upper search value.");
+        return false;
+    }
+    Fail("Unknown scan type.");
+    return false;
+  }
+
+  size_t estimate_memory_usage() const override {
+    return 2 * sizeof(T) + sizeof(size_t) + (_histogram ? _histogram->estimate_memory_usage() : 0) +
+           (_bloom_filter ? _bloom_filter->estimate_memory_usage() : 0);
+  }
+
+ protected:
+  T _min;
+  T _max;
+  size_t _distinct_count;
+  std::shared_ptr<const EquiDepthHistogram<T>> _histogram;
+  std::shared_ptr<const BloomFilter> _bloom_filter;
+};
+
+namespace detail {
+
+// returns how often each value id occurs in the attribute vector
+inline std::vector<size_t> count_value_ids(const BaseAttributeVector& attribute_vector, const size_t dictionary_size) {
+  auto counts = std::vector<size_t>(dictionary_size);
+  auto value_ids = std::array<ValueID, materialize_block_size>{};
+  const auto size = attribute_vector.size();
+  for (auto block_begin = size_t{0}; block_begin < size; block_begin += materialize_block_size) {
+    const auto block_length = std::min(materialize_block_size, size - block_begin);
+    attribute_vector.decode(block_begin, block_length, value_ids.data());
+    for (auto index = size_t{0}; index < block_length; ++index) ++counts[value_ids[index]];
+  }
+  return counts;
+}
+
+}  // namespace detail
+
+// Computes the statistics of a segment of data type T, including a histogram. Dictionary-encoded segments are read
+// from their dictionaries and attribute vectors, all other segments are materialized and sorted once. If a
+// false-positive rate is given, a Bloom filter over the distinct values is built as well. Returns nullptr for empty
+// segments, since they have no min and max.
+template <typename T>
+std::shared_ptr<SegmentStatistics<T>> compute_segment_statistics(
+    const BaseSegment& segment, const std::optional<double> bloom_filter_false_positive_rate = std::nullopt) {
+  if (segment.size() == 0) return nullptr;
+
+  // builds the statistics from the sorted distinct values and the number of times each of them occurs
+  const auto make_statistics = [&](const std::vector<T>& distinct_values, const std::vector<size_t>& counts) {
+    auto bloom_filter = std::shared_ptr<BloomFilter>{};
+    if (bloom_filter_false_positive_rate) {
+      bloom_filter = std::make_shared<BloomFilter>(distinct_values.size(), *bloom_filter_false_positive_rate);
+      for (const auto& value : distinct_values) bloom_filter->insert(value);
+    }
+    return std::make_shared<SegmentStatistics<T>>(distinct_values.front(), distinct_values.back(),
+                                                  distinct_values.size(),
+                                                  EquiDepthHistogram<T>::from_value_counts(distinct_values, counts),
+                                                  std::move(bloom_filter));
+  };
+
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    return make_statistics(dictionary, detail::count_value_ids(*dictionary_segment->attribute_vector(),
+                                                               dictionary.size()));
+  }
+
+  auto values = std::vector<T>{};
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (const auto* front_coded_segment = dynamic_cast<const FrontCodedDictionarySegment*>(&segment)) {
+      const auto& dictionary = *front_coded_segment->dictionary();
+      values.reserve(dictionary.size());
+      for (auto value_id = uint32_t{0}; value_id < dictionary.size(); ++value_id) {
+        values.push_back(dictionary.value_by_value_id(ValueID{value_id}));
+      }
+      return make_statistics(values,
+                             detail::count_value_ids(*front_coded_segment->attribute_vector(), dictionary.size()));
+    }
+  }
+
+  materialize_values(segment, values);
+  std::sort(values.begin(), values.end());
+
+  // counts the runs of equal values while moving the distinct values to the front
+  auto counts = std::vector<size_t>{};
+  auto distinct_count = size_t{0};
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    if (index > 0 && values[index] == values[distinct_count - 1]) {
+      ++counts.back();
+      continue;
+    }
+    if (distinct_count != index) values[distinct_count] = std::move(values[index]);
+    ++distinct_count;
+    counts.push_back(1);
+  }
+  values.resize(distinct_count);
+  return make_statistics(values, counts);
+}
+
+// same as above, for a segment whose data type is given as a string
+inline std::shared_ptr<BaseSegmentStatistics> compute_segment_statistics(
+    const std::string& type, const BaseSegment& segment,
+    const std::optional<double> bloom_filter_false_positive_rate = std::nullopt) {
+  auto statistics = std::shared_ptr<BaseSegmentStatistics>{};
+  resolve_data_type(type, [&](auto data_type) {
+    using Type = typename decltype(data_type)::type;
+    statistics = compute_segment_statistics<Type>(segment, bloom_filter_false_positive_rate);
+  });
+  return statistics;
+}
+
+}  // namespace opossum
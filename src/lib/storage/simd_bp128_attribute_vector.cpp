@@ -0,0 +1,274 @@
+#include "simd_bp128_attribute_vector.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define OPOSSUM_SIMD_BP128_X86 1
+#else
+#define OPOSSUM_SIMD_BP128_X86 0
+#endif
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+static_assert(sizeof(ValueID) == sizeof(uint32_t), "Kernels write value ids as plain uint32_t");
+
+// Every kernel reads the word following the one a value starts in, even if the value does not span both. Padding the
+// data with one 128-bit word keeps this read in bounds for the last block.
+constexpr auto padding_words = size_t{4};
+
+using UnpackFunction = void (*)(const uint32_t*, uint32_t*);
+
+constexpr uint32_t mask_for_bit_width(const uint8_t bit_width) {
+  return bit_width == 32 ? ~uint32_t{0} : (uint32_t{1} << bit_width) - 1;
+}
+
+uint8_t bit_width_for_value(const uint32_t value) {
+  return value == 0 ? 0 : static_cast<uint8_t>(32 - __builtin_clz(value));
+}
+
+void unpack_block_scalar(const uint32_t* in, const uint8_t bit_width, uint32_t* out) {
+  // blocks of width 0 store no words, so the last block of the data may not even have the padding word after it
+  if (bit_width == 0) {
+    std::fill(out, out + SimdBp128AttributeVector::block_size, uint32_t{0});
+    return;
+  }
+
+  const auto mask = mask_for_bit_width(bit_width);
+  for (auto lane = uint32_t{0}; lane < 4; ++lane) {
+    auto bit_position = uint32_t{0};
+    for (auto lane_position = uint32_t{0}; lane_position < 32; ++lane_position) {
+      const auto word = bit_position >> 5;
+      const auto words = uint64_t{in[4 * word + lane]} | (uint64_t{in[4 * (word + 1) + lane]} << 32);
+      out[4 * lane_position + lane] = static_cast<uint32_t>(words >> (bit_position & 31)) & mask;
+      bit_position += bit_width;
+    }
+  }
+}
+
+#if OPOSSUM_SIMD_BP128_X86
+
+// Decodes the four value ids at lane position p with a single shift and mask. Shifting left by 32 yields 0, so values
+// that do not span two words need no special treatment.
+template <uint8_t bit_width>
+__attribute__((target("sse2"))) void unpack_block_sse2(const uint32_t* in, uint32_t* out) {
+  const auto* in_words = reinterpret_cast<const __m128i*>(in);
+  auto* out_words = reinterpret_cast<__m128i*>(out);
+
+  if constexpr (bit_width == 0) {
+    for (auto lane_position = uint32_t{0}; lane_position < 32; ++lane_position) {
+      _mm_storeu_si128(out_words + lane_position, _mm_setzero_si128());
+    }
+  } else {
+    const auto mask = _mm_set1_epi32(static_cast<int32_t>(mask_for_bit_width(bit_width)));
+    for (auto lane_position = uint32_t{0}; lane_position < 32; ++lane_position) {
+      const auto bit_position = lane_position * bit_width;
+      const auto word = bit_position >> 5;
+      const auto shift = static_cast<int32_t>(bit_position & 31);
+      const auto low = _mm_srl_epi32(_mm_loadu_si128(in_words + word), _mm_cvtsi32_si128(shift));
+      const auto high = _mm_sll_epi32(_mm_loadu_si128(in_words + word + 1), _mm_cvtsi32_si128(32 - shift));
+      _mm_storeu_si128(out_words + lane_position, _mm_and_si128(_mm_or_si128(low, high), mask));
+    }
+  }
+}
+
+// Same as the SSE2 kernel, but decodes two lane positions (eight value ids) per iteration. Both halves of the register
+// use their own shift amount, which AVX2's variable shifts allow.
+template <uint8_t bit_width>
+__attribute__((target("avx2"))) void unpack_block_avx2(const uint32_t* in, uint32_t* out) {
+  const auto* in_words = reinterpret_cast<const __m128i*>(in);
+  auto* out_words = reinterpret_cast<__m256i*>(out);
+
+  if constexpr (bit_width == 0) {
+    for (auto lane_position = uint32_t{0}; lane_position < 32; lane_position += 2) {
+      _mm256_storeu_si256(out_words + lane_position / 2, _mm256_setzero_si256());
+    }
+  } else {
+    const auto mask = _mm256_set1_epi32(static_cast<int32_t>(mask_for_bit_width(bit_width)));
+    for (auto lane_position = uint32_t{0}; lane_position < 32; lane_position += 2) {
+      const auto first_bit_position = lane_position * bit_width;
+      const auto second_bit_position = first_bit_position + bit_width;
+      const auto first_word = first_bit_position >> 5;
+      const auto second_word = second_bit_position >> 5;
+      const auto first_shift = static_cast<int32_t>(first_bit_position & 31);
+      const auto second_shift = static_cast<int32_t>(second_bit_position & 31);
+
+      const auto low = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(in_words + first_word)),
+                                               _mm_loadu_si128(in_words + second_word), 1);
+      const auto high = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(in_words + first_word + 1)),
+                                                _mm_loadu_si128(in_words + second_word + 1), 1);
+      const auto right_shifts = _mm256_set_epi32(second_shift, second_shift, second_shift, second_shift, first_shift,
+                                                 first_shift, first_shift, first_shift);
+      const auto left_shifts = _mm256_sub_epi32(_mm256_set1_epi32(32), right_shifts);
+
+      const auto values = _mm256_or_si256(_mm256_srlv_epi32(low, right_shifts), _mm256_sllv_epi32(high, left_shifts));
+      _mm256_storeu_si256(out_words + lane_position / 2, _mm256_and_si256(values, mask));
+    }
+  }
+}
+
+template <size_t... bit_widths>
+constexpr std::array<UnpackFunction, sizeof...(bit_widths)> make_sse2_kernels(std::index_sequence<bit_widths...>) {
+  return {{&unpack_block_sse2<static_cast<uint8_t>(bit_widths)>...}};
+}
+
+template <size_t... bit_widths>
+constexpr std::array<UnpackFunction, sizeof...(bit_widths)> make_avx2_kernels(std::index_sequence<bit_widths...>) {
+  return {{&unpack_block_avx2<static_cast<uint8_t>(bit_widths)>...}};
+}
+
+// indexed by bit width (0 to 32)
+constexpr auto sse2_kernels = make_sse2_kernels(std::make_index_sequence<33>{});
+constexpr auto avx2_kernels = make_avx2_kernels(std::make_index_sequence<33>{});
+
+#endif
+
+}  // namespace
+
+SimdBp128AttributeVector::SimdBp128AttributeVector(const std::vector<ValueID>& value_ids) : _size(value_ids.size()) {
+  const auto block_count = (_size + block_size - 1) / block_size;
+  _block_bit_widths.reserve(block_count);
+  _block_offsets.reserve(block_count);
+
+  // first pass: determine the bit width and thereby the position of each block
+  auto word_count = size_t{0};
+  for (auto block_begin = size_t{0}; block_begin < _size; block_begin += block_size) {
+    const auto block_end = std::min(block_begin + block_size, _size);
+    const auto max_value_id = *std::max_element(value_ids.cbegin() + block_begin, value_ids.cbegin() + block_end);
+    const auto bit_width = bit_width_for_value(max_value_id);
+
+    _block_bit_widths.push_back(bit_width);
+    _block_offsets.push_back(static_cast<uint32_t>(word_count));
+    _max_bit_width = std::max(_max_bit_width, bit_width);
+    word_count += 4 * bit_width;
+  }
+
+  // second pass: pack the value ids into their lanes
+  _data.resize(word_count + padding_words);
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto bit_width = _block_bit_widths[block_index];
+    if (bit_width == 0) continue;
+
+    auto* block_data = _data.data() + _block_offsets[block_index];
+    const auto block_begin = block_index * block_size;
+    const auto block_end = std::min(block_begin + block_size, _size);
+
+    for (auto position = block_begin; position < block_end; ++position) {
+      const auto index_in_block = static_cast<uint32_t>(position - block_begin);
+      const auto lane = index_in_block & 3;
+      const auto bit_position = (index_in_block >> 2) * bit_width;
+      const auto word = bit_position >> 5;
+      const auto shift = bit_position & 31;
+      const auto value = static_cast<uint32_t>(value_ids[position]);
+
+      block_data[4 * word + lane] |= value << shift;
+      if (shift + bit_width > 32) {
+        block_data[4 * (word + 1) + lane] |= value >> (32 - shift);
+      }
+    }
+  }
+}
+
+ValueID SimdBp128AttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "Position is out of range.");
+  const auto block_index = i / block_size;
+  const auto bit_width = _block_bit_widths[block_index];
+  if (bit_width == 0) return ValueID{0};
+  const auto* block_data = _data.data() + _block_offsets[block_index];
+
+  const auto index_in_block = static_cast<uint32_t>(i % block_size);
+  const auto lane = index_in_block & 3;
+  const auto bit_position = (index_in_block >> 2) * bit_width;
+  const auto word = bit_position >> 5;
+  const auto words = uint64_t{block_data[4 * word + lane]} | (uint64_t{block_data[4 * (word + 1) + lane]} << 32);
+  return ValueID{static_cast<uint32_t>(words >> (bit_position & 31)) & mask_for_bit_width(bit_width)};
+}
+
+void SimdBp128AttributeVector::set(const size_t i, const ValueID value_id) {
+  Fail("SimdBp128AttributeVector is immutable.");
+}
+
+void SimdBp128AttributeVector::decode(const size_t begin, const size_t count, ValueID* out) const {
+  DebugAssert(begin + count <= _size, "Range is out of bounds.");
+  const auto selected_kernel = kernel();
+  std::array<ValueID, block_size> buffer;
+
+  auto position = begin;
+  const auto end = begin + count;
+  while (position < end) {
+    const auto block_index = position / block_size;
+    const auto offset_in_block = position % block_size;
+    const auto values_from_block = std::min(block_size - offset_in_block, end - position);
+
+    if (values_from_block == block_size) {
+      // full blocks are decoded directly into the caller's buffer
+      decode_block(block_index, out, selected_kernel);
+    } else {
+      decode_block(block_index, buffer.data(), selected_kernel);
+      std::copy_n(buffer.cbegin() + offset_in_block, values_from_block, out);
+    }
+
+    out += values_from_block;
+    position += values_from_block;
+  }
+}
+
+void SimdBp128AttributeVector::decode_block(const size_t block_index, ValueID* out, const Kernel kernel) const {
+  DebugAssert(block_index < _block_bit_widths.size(), "Block index is out of range.");
+  DebugAssert(is_supported(kernel), "Kernel is not supported on this CPU.");
+  const auto bit_width = _block_bit_widths[block_index];
+  const auto* in = _data.data() + _block_offsets[block_index];
+  auto* out_words = reinterpret_cast<uint32_t*>(out);
+
+  switch (kernel) {
+#if OPOSSUM_SIMD_BP128_X86
+    case Kernel::Avx2:
+      avx2_kernels[bit_width](in, out_words);
+      return;
+    case Kernel::Sse2:
+      sse2_kernels[bit_width](in, out_words);
+      return;
+#endif
+    default:
+      unpack_block_scalar(in, bit_width, out_words);
+  }
+}
+
+size_t SimdBp128AttributeVector::size() const { return _size; }
+
+AttributeVectorWidth SimdBp128AttributeVector::width() const { return std::max((_max_bit_width + 7) / 8, 1); }
+
+size_t SimdBp128AttributeVector::estimate_memory_usage() const {
+  return _data.size() * sizeof(uint32_t) + _block_bit_widths.size() * sizeof(uint8_t) +
+         _block_offsets.size() * sizeof(uint32_t);
+}
+
+SimdBp128AttributeVector::Kernel SimdBp128AttributeVector::kernel() {
+  static const auto selected_kernel =
+      is_supported(Kernel::Avx2) ? Kernel::Avx2 : is_supported(Kernel::Sse2) ? Kernel::Sse2 : Kernel::Scalar;
+  return selected_kernel;
+}
+
+bool SimdBp128AttributeVector::is_supported(const Kernel kernel) {
+  switch (kernel) {
+#if OPOSSUM_SIMD_BP128_X86
+    case Kernel::Avx2:
+      return __builtin_cpu_supports("avx2");
+    case Kernel::Sse2:
+      return __builtin_cpu_supports("sse2");
+#endif
+    case Kernel::Scalar:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// SimdBp128AttributeVector packs value ids in blocks of 128, each block with its own bit width (0 to 32 bits).
+//
+// Within a block, value id j is assigned to lane j % 4 and packed into that lane's stream of 32-bit words. The words
+// of the four lanes are interleaved, so a single 128-bit load yields the same word of all lanes, and one shift plus
+// mask yields four consecutive value ids. This is the layout of SIMD-BP128 (Lemire and Boytsov, "Decoding billions of
+// integers per second through vectorization").
+//
+// The block kernel (AVX2, SSE2 or scalar) is chosen once at runtime, depending on what the CPU supports. The vector is
+// immutable - all value ids have to be known at construction time to choose the per-block bit widths.
+class SimdBp128AttributeVector final : public BaseAttributeVector {
+ public:
+  enum class Kernel : uint8_t { Scalar, Sse2, Avx2 };
+
+  static constexpr size_t block_size = 128;
+
+  explicit SimdBp128AttributeVector(const std::vector<ValueID>& value_ids);
+  ~SimdBp128AttributeVector() override = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  SimdBp128AttributeVector(SimdBp128AttributeVector&&) = default;
+  SimdBp128AttributeVector& operator=(SimdBp128AttributeVector&&) = default;
+
+  // returns the value id at a given position
+  ValueID get(const size_t i) const override;
+
+  // SimdBp128AttributeVectors are immutable
+  void set(const size_t i, const ValueID value_id) override;
+
+  // decodes `count` value ids starting at position `begin` into `out`, unpacking whole blocks at a time
+  void decode(const size_t begin, const size_t count, ValueID* out) const override;
+
+  // decodes all 128 value ids of a block into `out` with the given kernel. Positions of the last block that exceed
+  // size() are decoded as 0.
+  void decode_block(const size_t block_index, ValueID* out, const Kernel kernel) const;
+
+  // returns the number of values
+  size_t size() const override;
+
+  // returns the width of biggest value id in bytes, rounded up
+  AttributeVectorWidth width() const override;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const override;
+
+  // returns the kernel that is used on this CPU
+  static Kernel kernel();
+
+  // returns whether the given kernel can be executed on this CPU
+  static bool is_supported(const Kernel kernel);
+
+ protected:
+  size_t _size;
+  uint8_t _max_bit_width = 0;
+  std::vector<uint8_t> _block_bit_widths;
+  // offset of each block's first word in _data
+  std::vector<uint32_t> _block_offsets;
+  std::vector<uint32_t> _data;
+};
+}  // namespace opossum
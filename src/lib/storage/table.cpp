@@ -1,28 +1,58 @@
 #include "table.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <future>
 #include <iomanip>
 #include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
-#include <thread>
 #include <utility>
 #include <vector>
 
-#include "dictionary_segment.hpp"
+#include "b_plus_tree_index.hpp"
+#include "cold_segment.hpp"
+#include "encoding_advisor.hpp"
+#include "hash_index.hpp"
 #include "resolve_type.hpp"
+#include "segment_encoding_utils.hpp"
+#include "segment_statistics.hpp"
+#include "table_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
 
 namespace opossum {
 
-Table::Table(uint32_t chunk_size) : _max_chunk_size(chunk_size) { _chunks.emplace_back(); }
+namespace {
+
+// returns whether the values of a ValueSegment are sorted in ascending order
+bool is_sorted_ascending(const std::string& type, const BaseSegment& segment) {
+  auto is_sorted = false;
+  resolve_data_type(type, [&](auto data_type) {
+    using Type = typename decltype(data_type)::type;
+    const auto typed_segment = dynamic_cast<const ValueSegment<Type>*>(&segment);
+    Assert(typed_segment, "Only ValueSegments can be encoded.");
+    const auto& values = typed_segment->values();
+    is_sorted = std::is_sorted(values.cbegin(), values.cend());
+  });
+  return is_sorted;
+}
+
+}  // namespace
+
+Table::Table(uint32_t chunk_size) : _max_chunk_size(chunk_size) {
+  _chunks.emplace_back();
+  _invalidate_table_statistics();
+}
 
 void Table::add_column_definition(const std::string& name, const std::string& type) {
-  // Implementation goes here
+  std::lock_guard<std::mutex> lock_guard(*_access_mutex);
+  _column_names.push_back(name);
+  _column_types.push_back(type);
+  _bloom_filter_false_positive_rates.emplace_back();
+  _invalidate_table_statistics();
 }
 
 void Table::add_column(const std::string& name, const std::string& type) {
@@ -31,10 +61,12 @@ void Table::add_column(const std::string& name, const std::string& type) {
 
   _column_names.push_back(name);
   _column_types.push_back(type);
+  _bloom_filter_false_positive_rates.emplace_back();
 
   auto segment = make_shared_by_data_type<BaseSegment, ValueSegment>(type);
 
   _chunks.front().add_segment(segment);
+  _invalidate_table_statistics();
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
@@ -50,15 +82,24 @@ void Table::append(std::vector<AllTypeVariant> values) {
   }
 
   _chunks.back().append(values);
+
+  const auto row_id = RowID{static_cast<ChunkID>(_chunks.size() - 1), _chunks.back().size() - 1};
+  for (const auto& index : _b_plus_tree_indexes) index->insert(values, row_id);
+  for (const auto& index : _hash_indexes) index->insert(values[index->column_id()], row_id);
 }
 
-uint16_t Table::column_count() const { return _chunks.front().column_count(); }
+uint16_t Table::column_count() const { return static_cast<uint16_t>(_column_names.size()); }
 
 void Table::create_new_chunk() {
   // Implementation goes here
 }
 
-uint64_t Table::row_count() const { return (_chunks.size() - 1) * _max_chunk_size + _chunks.back().size(); }
+uint64_t Table::row_count() const {
+  // chunks that were added with emplace_chunk, e.g., by operators, are not necessarily full
+  auto row_count = uint64_t{0};
+  for (const auto& chunk : _chunks) row_count += chunk.size();
+  return row_count;
+}
 
 ChunkID Table::chunk_count() const { return static_cast<ChunkID>(_chunks.size()); }
 
@@ -88,33 +129,189 @@ Chunk& Table::get_chunk(ChunkID chunk_id) {
 const Chunk& Table::get_chunk(ChunkID chunk_id) const { return _chunks.at(chunk_id); }
 
 void Table::compress_chunk(ChunkID chunk_id) {
+  compress_chunk(chunk_id, std::vector<SegmentEncodingSpec>(_column_types.size()));
+}
+
+void Table::compress_chunk(ChunkID chunk_id, const std::vector<SegmentEncodingSpec>& encoding_specs) {
+  Assert(encoding_specs.size() == _column_types.size(), "Need exactly one encoding spec per column.");
+  for (std::size_t i = 0; i < _column_types.size(); i++) {
+    Assert(is_encoding_supported(_column_types[i], encoding_specs[i].encoding_type),
+           "Encoding is not supported for columns of type " + _column_types[i] + ".");
+  }
+
   std::lock_guard<std::mutex> lock_guard(*_access_mutex);
   Chunk compressed_chunk;
   auto& current_chunk = _chunks.at(chunk_id);
+  // demote_cold_chunks also wraps chunks that were never compressed, whose ColdSegments rebuild ValueSegments
+  std::vector<std::shared_ptr<BaseSegment>> value_segments(_column_types.size());
+  for (std::size_t i = 0; i < _column_types.size(); i++) {
+    value_segments[i] = current_chunk.get_segment(ColumnID(i));
+    if (const auto cold_segment = std::dynamic_pointer_cast<ColdSegment>(value_segments[i])) {
+      value_segments[i] = cold_segment->segment();
+    }
+  }
+  for (std::size_t i = 0; i < _column_types.size(); i++) {
+    Assert(can_encode_values(_column_types[i], value_segments[i], encoding_specs[i]),
+           "The values of column " + _column_names[i] + " cannot be encoded as requested.");
+  }
 
-  std::vector<std::thread> threads;
   std::vector<std::shared_ptr<BaseSegment>> compressed_segments(_column_types.size());
-  threads.reserve(_column_types.size());
-
-  // compressing one chunks means turning all the ValueSegments into DictionarySegments
+  std::vector<std::shared_ptr<BaseSegmentStatistics>> segment_statistics(_column_types.size());
+  // not a std::vector<bool>, whose elements cannot be written by different threads
+  std::vector<uint8_t> segment_is_sorted(_column_types.size());
+  // declared after the results, so that they are destroyed first and wait for all columns if one of them throws
+  std::vector<std::future<void>> futures;
+  futures.reserve(_column_types.size());
+
+  // compressing one chunk means turning all the ValueSegments into encoded segments. The statistics are computed from
+  // the encoded segments, which is cheap for dictionaries. Exceptions of a column are rethrown by future.get(), before
+  // the chunk is modified.
   for (std::size_t i = 0; i < _column_types.size(); i++) {
-    threads.emplace_back([& compressed_segment = compressed_segments[i], &column_type = _column_types[i],
-                          value_segment = current_chunk.get_segment(ColumnID(i))] {
-      compressed_segment = make_shared_by_data_type<BaseSegment, DictionarySegment>(column_type, value_segment);
-    });
+    futures.emplace_back(std::async(std::launch::async, [&compressed_segment = compressed_segments[i],
+                                                         &statistics = segment_statistics[i],
+                                                         &is_sorted = segment_is_sorted[i],
+                                                         &column_type = _column_types[i],
+                                                         &encoding_spec = encoding_specs[i],
+                                                         &false_positive_rate = _bloom_filter_false_positive_rates[i],
+                                                         value_segment = value_segments[i]] {
+      compressed_segment = encode_segment(column_type, value_segment, encoding_spec);
+      statistics = compute_segment_statistics(column_type, *compressed_segment, false_positive_rate);
+      is_sorted = is_sorted_ascending(column_type, *value_segment);
+    }));
   }
 
+  for (auto& future : futures) {
+    future.get();
+  }
   for (std::size_t i = 0; i < _column_types.size(); i++) {
-    threads[i].join();
     compressed_chunk.add_segment(compressed_segments[i]);
   }
+  for (std::size_t i = 0; i < _column_types.size(); i++) {
+    compressed_chunk.set_statistics(ColumnID(i), segment_statistics[i]);
+    if (segment_is_sorted[i]) compressed_chunk.set_sorted_by(ColumnID(i));
+  }
 
   // then switch the current chunk with the newly compressed one
   current_chunk = std::move(compressed_chunk);
+  _invalidate_table_statistics();
 }
 
-void emplace_chunk(Chunk chunk) {
-  // Implementation goes here
+std::shared_ptr<const TableStatistics> Table::table_statistics() const {
+  if (auto table_statistics = std::atomic_load(&_table_statistics)) return table_statistics;
+
+  // merging the statistics of all chunks once per change, instead of once per compressed chunk, keeps compressing a
+  // table linear. The lock keeps the chunks from changing while they are merged.
+  std::lock_guard<std::mutex> lock_guard(*_access_mutex);
+  auto table_statistics = std::atomic_load(&_table_statistics);
+  if (!table_statistics) {
+    table_statistics = std::make_shared<TableStatistics>(*this);
+    std::atomic_store(&_table_statistics, table_statistics);
+  }
+  return table_statistics;
+}
+
+void Table::_invalidate_table_statistics() {
+  // readers may hold on to the previous statistics, so they are dropped instead of being modified
+  std::atomic_store(&_table_statistics, std::shared_ptr<const TableStatistics>{});
+}
+
+void Table::compress_chunk(ChunkID chunk_id, EncodingAdvisor& advisor) {
+  compress_chunk(chunk_id, advisor.advise(*this, chunk_id));
+}
+
+void Table::set_bloom_filter_false_positive_rate(ColumnID column_id, std::optional<double> false_positive_rate) {
+  Assert(!false_positive_rate || (*false_positive_rate > 0.0 && *false_positive_rate < 1.0),
+         "False-positive rate has to be in (0, 1).");
+  std::lock_guard<std::mutex> lock_guard(*_access_mutex);
+  _bloom_filter_false_positive_rates.at(column_id) = false_positive_rate;
+}
+
+std::optional<double> Table::bloom_filter_false_positive_rate(ColumnID column_id) const {
+  return _bloom_filter_false_positive_rates.at(column_id);
+}
+
+size_t Table::demote_cold_chunks(const std::chrono::steady_clock::duration idle_time) {
+  std::lock_guard<std::mutex> lock_guard(*_access_mutex);
+  const auto now = std::chrono::steady_clock::now();
+  auto demoted_chunk_count = size_t{0};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id + 1 < _chunks.size(); ++chunk_id) {
+    auto& chunk = _chunks[chunk_id];
+    if (now - chunk.last_access() < idle_time) continue;
+
+    auto demoted = false;
+    for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+      const auto segment = chunk.get_segment(column_id);
+      if (const auto cold_segment = std::dynamic_pointer_cast<ColdSegment>(segment)) {
+        cold_segment->evict();
+        for (const auto& index : chunk.get_indexes(column_id)) chunk.remove_index(index);
+      } else {
+        chunk.replace_segment(column_id, std::make_shared<ColdSegment>(_column_types[column_id], segment));
+        demoted = true;
+      }
+    }
+    if (demoted) ++demoted_chunk_count;
+  }
+
+  return demoted_chunk_count;
+}
+
+void Table::emplace_chunk(Chunk chunk) {
+  std::lock_guard<std::mutex> lock_guard(*_access_mutex);
+  if (_chunks.size() == 1 && _chunks.front().size() == 0) {
+    _chunks.front() = std::move(chunk);
+  } else {
+    _chunks.push_back(std::move(chunk));
+  }
+
+  const auto chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
+  for (const auto& index : _b_plus_tree_indexes) index->insert_chunk(_chunks.back(), chunk_id);
+  for (const auto& index : _hash_indexes) index->insert_chunk(_chunks.back(), chunk_id);
+}
+
+std::shared_ptr<BPlusTreeIndex> Table::create_b_plus_tree_index(const std::vector<ColumnID>& column_ids) {
+  std::lock_guard<std::mutex> lock_guard(*_access_mutex);
+  auto column_types = std::vector<std::string>{};
+  for (const auto& column_id : column_ids) column_types.push_back(column_type(column_id));
+
+  auto index = std::make_shared<BPlusTreeIndex>(column_ids, std::move(column_types));
+  for (auto chunk_id = ChunkID{0}; chunk_id < _chunks.size(); ++chunk_id) {
+    index->insert_chunk(_chunks[chunk_id], chunk_id);
+  }
+  _b_plus_tree_indexes.push_back(index);
+  return index;
+}
+
+std::shared_ptr<BPlusTreeIndex> Table::get_b_plus_tree_index(const std::vector<ColumnID>& column_ids) const {
+  for (const auto& index : _b_plus_tree_indexes) {
+    if (index->column_ids() == column_ids) return index;
+  }
+  return nullptr;
+}
+
+std::shared_ptr<BaseTableHashIndex> Table::create_hash_index(const ColumnID column_id) {
+  std::lock_guard<std::mutex> lock_guard(*_access_mutex);
+  auto index = make_shared_by_data_type<BaseTableHashIndex, TableHashIndex>(column_type(column_id), column_id);
+  for (auto chunk_id = ChunkID{0}; chunk_id < _chunks.size(); ++chunk_id) {
+    index->insert_chunk(_chunks[chunk_id], chunk_id);
+  }
+  _hash_indexes.push_back(index);
+  return index;
+}
+
+std::shared_ptr<BaseTableHashIndex> Table::get_hash_index(const ColumnID column_id) const {
+  for (const auto& index : _hash_indexes) {
+    if (index->column_id() == column_id) return index;
+  }
+  return nullptr;
+}
+
+size_t Table::estimate_index_memory_usage() const {
+  auto memory_usage = size_t{0};
+  for (const auto& index : _b_plus_tree_indexes) memory_usage += index->estimate_memory_usage();
+  for (const auto& index : _hash_indexes) memory_usage += index->estimate_memory_usage();
+  for (const auto& chunk : _chunks) memory_usage += chunk.estimate_index_memory_usage();
+  return memory_usage;
 }
 
 }  // namespace opossum
@@ -1,15 +1,18 @@
 #pragma once
 
+#include <chrono>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "encoding_type.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -17,6 +20,9 @@
 
 namespace opossum {
 
+class BPlusTreeIndex;
+class BaseTableHashIndex;
+class EncodingAdvisor;
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
@@ -87,11 +93,64 @@ class Table : private Noncopyable {
   // compresses a ValueSegment into a DictionarySegment
   void compress_chunk(ChunkID chunk_id);
 
+  // Compresses the ValueSegments of a chunk, encoding each column as described by its entry in encoding_specs. Throws
+  // if a spec does not fit its column, e.g., FrameOfReference for a string column or for a block of long values whose
+  // range exceeds 32 bits, and leaves the chunk unchanged.
+  void compress_chunk(ChunkID chunk_id, const std::vector<SegmentEncodingSpec>& encoding_specs);
+
+  // compresses the ValueSegments of a chunk with the encodings chosen by the advisor, which records its decisions
+  void compress_chunk(ChunkID chunk_id, EncodingAdvisor& advisor);
+
+  // Makes compress_chunk build a Bloom filter with the given false-positive rate for the column's segments, which lets
+  // equality scans skip chunks that do not contain the search value. Passing std::nullopt stops building them.
+  // Chunks that have already been compressed are not affected.
+  void set_bloom_filter_false_positive_rate(ColumnID column_id, std::optional<double> false_positive_rate);
+
+  // returns the false-positive rate of the column's Bloom filters, or std::nullopt if none are built
+  std::optional<double> bloom_filter_false_positive_rate(ColumnID column_id) const;
+
+  // Creates a B+-tree index over the given columns of all chunks. Table::append and Table::emplace_chunk add their rows
+  // to it. Since compress_chunk and demote_cold_chunks replace segments but do not move rows, the index stays valid.
+  std::shared_ptr<BPlusTreeIndex> create_b_plus_tree_index(const std::vector<ColumnID>& column_ids);
+
+  // returns the B+-tree index over exactly the given columns, or nullptr if there is none
+  std::shared_ptr<BPlusTreeIndex> get_b_plus_tree_index(const std::vector<ColumnID>& column_ids) const;
+
+  // Creates a hash index over the given column of all chunks, which answers equality lookups in constant time. Like
+  // B+-tree indexes, it is kept up to date by Table::append and Table::emplace_chunk.
+  std::shared_ptr<BaseTableHashIndex> create_hash_index(const ColumnID column_id);
+
+  // returns the hash index over the given column, or nullptr if there is none
+  std::shared_ptr<BaseTableHashIndex> get_hash_index(const ColumnID column_id) const;
+
+  // returns the calculated memory usage of all indexes of the table and of its chunks
+  size_t estimate_index_memory_usage() const;
+
+  // returns the statistics of all compressed chunks. They are merged anew on the first call after a chunk was
+  // compressed, and statistics returned earlier are not modified.
+  std::shared_ptr<const TableStatistics> table_statistics() const;
+
+  // Demotes all chunks that have not been scanned for at least `idle_time`: their segments are replaced by
+  // ColdSegments, and segments that are already cold drop their decompressed copy. The last chunk is never demoted
+  // because rows are still appended to it. Returns the number of chunks that were demoted, i.e., that had at least one
+  // segment replaced by a ColdSegment. Chunks whose segments were all cold already are not counted.
+  // The indexes of the demoted chunks, e.g., GroupKeyIndexes, are dropped: each of them keeps the segment it was built
+  // on in memory, which is what demoting frees. They have to be created again on the ColdSegments' rebuilt segments if
+  // needed. The table's B+-tree and hash indexes are kept.
+  size_t demote_cold_chunks(const std::chrono::steady_clock::duration idle_time);
+
  protected:
+  // drops the merged statistics, so that the next call to table_statistics() merges them anew
+  void _invalidate_table_statistics();
+
   uint32_t _max_chunk_size;
   std::vector<Chunk> _chunks;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
+  std::vector<std::optional<double>> _bloom_filter_false_positive_rates;
+  mutable std::shared_ptr<const TableStatistics> _table_statistics;
+  std::vector<std::shared_ptr<BPlusTreeIndex>> _b_plus_tree_indexes;
+  std::vector<std::shared_ptr<BaseTableHashIndex>> _hash_indexes;
   std::unique_ptr<std::mutex> _access_mutex = std::make_unique<std::mutex>();
 };
 }  // namespace opossum
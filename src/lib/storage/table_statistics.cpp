@@ -0,0 +1,111 @@
+#include "table_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "equi_depth_histogram.hpp"
+#include "resolve_type.hpp"
+#include "segment_statistics.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Segments whose value ranges overlap, e.g., because each chunk holds the same few values, are assumed to share their
+// values, so each group of overlapping segments has as many distinct values as its segment with the most of them.
+// The distinct counts of disjoint groups add up.
+template <typename T>
+size_t merge_distinct_counts(std::vector<std::shared_ptr<const SegmentStatistics<T>>> segment_statistics) {
+  std::sort(segment_statistics.begin(), segment_statistics.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs->typed_min() < rhs->typed_min(); });
+
+  auto distinct_count = size_t{0};
+  auto group_distinct_count = size_t{0};
+  const T* group_max = nullptr;
+  for (const auto& statistics : segment_statistics) {
+    if (!group_max || *group_max < statistics->typed_min()) {
+      distinct_count += group_distinct_count;
+      group_distinct_count = statistics->distinct_count();
+      group_max = &statistics->typed_max();
+    } else {
+      group_distinct_count = std::max(group_distinct_count, statistics->distinct_count());
+      if (*group_max < statistics->typed_max()) group_max = &statistics->typed_max();
+    }
+  }
+  return distinct_count + group_distinct_count;
+}
+
+}  // namespace
+
+TableStatistics::TableStatistics(const Table& table) {
+  _histograms.resize(table.column_count());
+  _distinct_counts.resize(table.column_count());
+
+  // a chunk is covered if all of its segments have statistics, which compress_chunk computes for non-empty chunks
+  auto covered_chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0 || chunk.column_count() != table.column_count()) continue;
+
+    auto is_covered = true;
+    for (auto column_id = ColumnID{0}; column_id < table.column_count() && is_covered; ++column_id) {
+      is_covered = chunk.get_statistics(column_id) != nullptr;
+    }
+    if (!is_covered) continue;
+
+    covered_chunk_ids.push_back(chunk_id);
+    _row_count += chunk.size();
+  }
+  if (covered_chunk_ids.empty()) return;
+
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      auto segment_statistics = std::vector<std::shared_ptr<const SegmentStatistics<Type>>>{};
+      auto chunk_histograms = std::vector<std::shared_ptr<const EquiDepthHistogram<Type>>>{};
+      segment_statistics.reserve(covered_chunk_ids.size());
+      chunk_histograms.reserve(covered_chunk_ids.size());
+      for (const auto& chunk_id : covered_chunk_ids) {
+        const auto statistics = std::dynamic_pointer_cast<const SegmentStatistics<Type>>(
+            table.get_chunk(chunk_id).get_statistics(column_id));
+        DebugAssert(statistics && statistics->histogram(), "Segment statistics do not match the column type.");
+        segment_statistics.push_back(statistics);
+        chunk_histograms.push_back(statistics->histogram());
+      }
+      _histograms[column_id] = EquiDepthHistogram<Type>::merge(chunk_histograms, histogram_bin_count);
+      _distinct_counts[column_id] = merge_distinct_counts(std::move(segment_statistics));
+    });
+  }
+}
+
+uint64_t TableStatistics::row_count() const { return _row_count; }
+
+std::shared_ptr<const AbstractHistogram> TableStatistics::histogram(const ColumnID column_id) const {
+  return _histograms.at(column_id);
+}
+
+size_t TableStatistics::distinct_count(const ColumnID column_id) const {
+  return _distinct_counts.at(column_id);
+}
+
+double TableStatistics::null_fraction(const ColumnID column_id) const {
+  DebugAssert(column_id < _histograms.size(), "Column does not exist.");
+  return 0.0;
+}
+
+double TableStatistics::estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                                             const AllTypeVariant& search_value) const {
+  const auto& histogram = _histograms.at(column_id);
+  if (!histogram || histogram->total_count() == 0) return 1.0;
+
+  const auto selectivity =
+      histogram->estimate_cardinality(scan_type, search_value) / static_cast<double>(histogram->total_count());
+  return std::clamp(selectivity, 0.0, 1.0);
+}
+
+}  // namespace opossum
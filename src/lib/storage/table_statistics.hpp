@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractHistogram;
+class Table;
+
+// TableStatistics describe the values of each column of a table, so that the selectivity of predicates can be
+// estimated without executing anything, e.g., to choose the order of scans or joins.
+//
+// They are merged from the SegmentStatistics that Table::compress_chunk computes for each chunk, so they cover the
+// compressed chunks only. The table merges them anew on the first request after a chunk was compressed.
+class TableStatistics : private Noncopyable {
+ public:
+  static constexpr size_t histogram_bin_count = 64;
+
+  // merges the statistics of all compressed chunks of the table
+  explicit TableStatistics(const Table& table);
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  TableStatistics(TableStatistics&&) = default;
+  TableStatistics& operator=(TableStatistics&&) = default;
+
+  // returns the number of rows the statistics cover, i.e., the rows of all compressed chunks
+  uint64_t row_count() const;
+
+  // returns the histogram of a column, or nullptr if no chunk has been compressed yet
+  std::shared_ptr<const AbstractHistogram> histogram(const ColumnID column_id) const;
+
+  // returns the estimated number of distinct values of a column, merged from the distinct counts of its segments
+  size_t distinct_count(const ColumnID column_id) const;
+
+  // returns the fraction of NULL values of a column. Since segments cannot store NULLs yet, this is always 0.
+  double null_fraction(const ColumnID column_id) const;
+
+  // returns the estimated fraction of rows, between 0 and 1, for which `value <scan_type> search_value` holds in the
+  // given column. Without statistics, every row is assumed to match.
+  double estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                              const AllTypeVariant& search_value) const;
+
+ protected:
+  uint64_t _row_count = 0;
+  std::vector<std::shared_ptr<const AbstractHistogram>> _histograms;
+  std::vector<size_t> _distinct_counts;
+};
+
+}  // namespace opossum
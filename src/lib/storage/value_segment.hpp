@@ -13,6 +13,11 @@ namespace opossum {
 template <typename T>
 class ValueSegment : public BaseSegment {
  public:
+  ValueSegment() = default;
+
+  // creates a segment that takes over the given values
+  explicit ValueSegment(std::vector<T>&& values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
@@ -51,7 +51,17 @@ struct RowID {
   }
 };
 
-enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
+// OpBetween compares with a lower and an upper search value, so it is only supported where both can be passed (see
+// TableScan). Functions that take a single search value do not accept it.
+enum class ScanType {
+  OpEquals,
+  OpNotEquals,
+  OpLessThan,
+  OpLessThanEquals,
+  OpGreaterThan,
+  OpGreaterThanEquals,
+  OpBetween
+};
 
 using PosList = std::vector<RowID>;
 
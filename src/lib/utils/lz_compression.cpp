@@ -0,0 +1,174 @@
+#include "lz_compression.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr size_t min_match_length = 4;
+constexpr size_t max_distance = 65535;
+constexpr size_t hash_bits = 14;
+// the last bytes are always emitted as literals, so that the match search never reads past the end of the input
+constexpr size_t last_literals = 8;
+
+uint32_t read_uint32(const char* position) {
+  auto value = uint32_t{0};
+  std::memcpy(&value, position, sizeof(value));
+  return value;
+}
+
+uint32_t hash(const uint32_t sequence) { return (sequence * 2654435761u) >> (32 - hash_bits); }
+
+void append_length(std::vector<char>& output, size_t length) {
+  while (length >= 255) {
+    output.push_back(static_cast<char>(255));
+    length -= 255;
+  }
+  output.push_back(static_cast<char>(length));
+}
+
+void append_sequence(std::vector<char>& output, const char* literals, const size_t literal_count,
+                     const size_t match_length, const size_t distance) {
+  const auto literal_nibble = std::min(literal_count, size_t{15});
+  const auto match_nibble = match_length == 0 ? size_t{0} : std::min(match_length - min_match_length, size_t{15});
+  output.push_back(static_cast<char>((literal_nibble << 4) | match_nibble));
+  if (literal_nibble == 15) append_length(output, literal_count - 15);
+  output.insert(output.end(), literals, literals + literal_count);
+
+  if (match_length == 0) return;
+  output.push_back(static_cast<char>(distance & 0xFF));
+  output.push_back(static_cast<char>(distance >> 8));
+  if (match_nibble == 15) append_length(output, match_length - min_match_length - 15);
+}
+
+class Reader {
+ public:
+  explicit Reader(const std::vector<char>& input) : _position(input.data()), _end(input.data() + input.size()) {}
+
+  bool at_end() const { return _position == _end; }
+
+  uint8_t byte() {
+    Assert(_position < _end, "Compressed data is truncated.");
+    return static_cast<uint8_t>(*_position++);
+  }
+
+  size_t varint() {
+    auto value = size_t{0};
+    for (auto shift = 0; shift < 64; shift += 7) {
+      const auto next = byte();
+      value |= static_cast<size_t>(next & 0x7F) << shift;
+      if ((next & 0x80) == 0) return value;
+    }
+    Fail("Malformed varint in compressed data.");
+    return 0;
+  }
+
+  // adds the continuation bytes of a nibble that is 15
+  size_t length(size_t nibble) {
+    if (nibble < 15) return nibble;
+    auto next = uint8_t{255};
+    while (next == 255) {
+      next = byte();
+      nibble += next;
+    }
+    return nibble;
+  }
+
+  const char* bytes(const size_t count) {
+    Assert(static_cast<size_t>(_end - _position) >= count, "Compressed data is truncated.");
+    const auto* begin = _position;
+    _position += count;
+    return begin;
+  }
+
+ protected:
+  const char* _position;
+  const char* _end;
+};
+
+}  // namespace
+
+std::vector<char> lz_compress(const char* data, const size_t size) {
+  auto output = std::vector<char>{};
+  output.reserve(size / 2 + 16);
+
+  auto remaining_size = size;
+  while (remaining_size >= 0x80) {
+    output.push_back(static_cast<char>((remaining_size & 0x7F) | 0x80));
+    remaining_size >>= 7;
+  }
+  output.push_back(static_cast<char>(remaining_size));
+
+  // positions are stored + 1, so that 0 means that the slot is empty
+  auto table = std::vector<uint32_t>(size_t{1} << hash_bits, 0);
+  auto literal_begin = size_t{0};
+  auto position = size_t{0};
+
+  while (size >= last_literals && position + last_literals <= size) {
+    const auto sequence = read_uint32(data + position);
+    auto& slot = table[hash(sequence)];
+    const auto candidate = static_cast<size_t>(slot);
+    slot = static_cast<uint32_t>(position + 1);
+
+    if (candidate == 0 || position - (candidate - 1) > max_distance ||
+        read_uint32(data + candidate - 1) != sequence) {
+      ++position;
+      continue;
+    }
+
+    const auto match_begin = candidate - 1;
+    auto match_length = min_match_length;
+    while (position + match_length < size - last_literals &&
+           data[match_begin + match_length] == data[position + match_length]) {
+      ++match_length;
+    }
+
+    append_sequence(output, data + literal_begin, position - literal_begin, match_length, position - match_begin);
+    position += match_length;
+    literal_begin = position;
+  }
+
+  append_sequence(output, data + literal_begin, size - literal_begin, 0, 0);
+  output.shrink_to_fit();
+  return output;
+}
+
+std::vector<char> lz_decompress(const std::vector<char>& compressed) {
+  auto reader = Reader{compressed};
+  const auto size = reader.varint();
+
+  auto output = std::vector<char>(size);
+  auto output_size = size_t{0};
+
+  while (true) {
+    const auto token = reader.byte();
+    const auto literal_count = reader.length(token >> 4);
+    const auto* literals = reader.bytes(literal_count);
+    Assert(output_size + literal_count <= size, "Compressed data is longer than announced.");
+    std::copy(literals, literals + literal_count, output.begin() + output_size);
+    output_size += literal_count;
+    if (reader.at_end()) break;
+
+    const auto distance_low = size_t{reader.byte()};
+    const auto distance = distance_low | (size_t{reader.byte()} << 8);
+    const auto match_length = reader.length(token & 0x0F) + min_match_length;
+    Assert(distance > 0 && distance <= output_size, "Malformed match in compressed data.");
+    Assert(output_size + match_length <= size, "Compressed data is longer than announced.");
+
+    // matches may overlap with the bytes they produce, so they are copied byte by byte
+    for (auto index = size_t{0}; index < match_length; ++index, ++output_size) {
+      output[output_size] = output[output_size - distance];
+    }
+  }
+
+  Assert(output_size == size, "Compressed data does not match the announced size.");
+  return output;
+}
+
+}  // namespace opossum
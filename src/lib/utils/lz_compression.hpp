@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace opossum {
+
+// A small LZ77-style byte codec in the spirit of LZ4, used to keep rarely accessed data compressed in memory. It favors
+// compression and decompression speed over ratio: matches are found through a single hash table probe, and
+// decompression only copies literals and earlier output.
+//
+// Format: the uncompressed size as a varint, followed by sequences. Each sequence starts with a token whose high
+// nibble is the number of literals and whose low nibble is the match length minus 4. A nibble of 15 is continued by
+// bytes that are added to it until a byte is smaller than 255. The token is followed by the literals and, unless the
+// sequence is the last one, the 16-bit little-endian distance to the match.
+
+// compresses `size` bytes starting at `data`
+std::vector<char> lz_compress(const char* data, const size_t size);
+
+// decompresses the output of lz_compress, throws std::logic_error if the input is malformed
+std::vector<char> lz_decompress(const std::vector<char>& compressed);
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <functional>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Calls `functor` with the std comparison function object that corresponds to `scan_type`, so that the comparison can
+// be inlined into the caller's loop instead of switching over the scan type for every value.
+//
+// Example:
+//   with_comparator(scan_type, [&](auto comparator) {
+//     for (...) if (comparator(values[i], search_value)) matches.push_back(i);
+//   });
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return functor(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return functor(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return functor(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return functor(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return functor(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return functor(std::greater_equal<>{});
+    case ScanType::OpBetween:
+      Fail("OpBetween needs an upper search value, see with_between_comparator.");
+      return;
+  }
+  Fail("Unknown scan type.");
+}
+
+// Calls `functor` with a function object that returns whether its first argument lies between its second and third
+// argument, which are included in the range or not as given.
+//
+// Example:
+//   with_between_comparator(true, false, [&](auto is_between) {
+//     for (...) if (is_between(values[i], lower_value, upper_value)) matches.push_back(i);
+//   });
+template <typename Functor>
+void with_between_comparator(const bool lower_is_inclusive, const bool upper_is_inclusive, const Functor& functor) {
+  const auto call_with = [&](auto lower_comparator, auto upper_comparator) {
+    functor([=](const auto& value, const auto& lower_value, const auto& upper_value) {
+      return lower_comparator(lower_value, value) && upper_comparator(value, upper_value);
+    });
+  };
+  if (lower_is_inclusive) {
+    if (upper_is_inclusive) return call_with(std::less_equal<>{}, std::less_equal<>{});
+    return call_with(std::less_equal<>{}, std::less<>{});
+  }
+  if (upper_is_inclusive) return call_with(std::less<>{}, std::less_equal<>{});
+  call_with(std::less<>{}, std::less<>{});
+}
+
+}  // namespace opossum
@@ -0,0 +1,141 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/conjunctive_table_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsConjunctiveTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // the chunks are dictionary encoded, except for a run-length encoded one and the last one
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "float");
+    for (auto i = 0; i < 1050; ++i) table->append({i, "name_" + std::to_string(i % 10), static_cast<float>(i % 7)});
+    for (auto chunk_id = ChunkID{0}; chunk_id < 10; ++chunk_id) {
+      if (chunk_id == 3) {
+        table->compress_chunk(chunk_id, {SegmentEncodingSpec{EncodingType::RunLength}, SegmentEncodingSpec{},
+                                         SegmentEncodingSpec{EncodingType::RunLength}});
+      } else {
+        table->compress_chunk(chunk_id);
+      }
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // returns the output of one TableScan per predicate, each scanning the output of the previous one
+  std::shared_ptr<const Table> scan_one_by_one(std::shared_ptr<const AbstractOperator> input,
+                                               const std::vector<ScanPredicate>& predicates) {
+    for (const auto& predicate : predicates) {
+      auto scan = std::make_shared<TableScan>(input, predicate.column_id, predicate.scan_type, predicate.search_value);
+      scan->execute();
+      input = scan;
+    }
+    return input->get_output();
+  }
+
+  // checks that both tables reference the same rows in the same chunks, and that all segments of a chunk share one
+  // position list
+  void expect_same_rows(const Table& table, const Table& expected_table) {
+    ASSERT_EQ(table.chunk_count(), expected_table.chunk_count());
+    EXPECT_EQ(table.row_count(), expected_table.row_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto pos_list = [&](const Table& referencing_table, const ColumnID column_id) {
+        const auto segment = referencing_table.get_chunk(chunk_id).get_segment(column_id);
+        return std::dynamic_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+      };
+      EXPECT_EQ(*pos_list(table, ColumnID{0}), *pos_list(expected_table, ColumnID{0}));
+      EXPECT_EQ(pos_list(table, ColumnID{1}), pos_list(table, ColumnID{0}));
+      EXPECT_EQ(pos_list(table, ColumnID{2}), pos_list(table, ColumnID{0}));
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsConjunctiveTableScanTest, MatchesTableScans) {
+  const auto predicates = std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThanEquals, 150},
+                                                     {ColumnID{1}, ScanType::OpEquals, "name_3"},
+                                                     {ColumnID{2}, ScanType::OpLessThan, 3.0f}};
+  auto scan = std::make_shared<ConjunctiveTableScan>(_table_wrapper, predicates);
+  scan->execute();
+  expect_same_rows(*scan->get_output(), *scan_one_by_one(_table_wrapper, predicates));
+  EXPECT_GT(scan->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, ScanOnReferenceSegments) {
+  auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpNotEquals, 6.0f);
+  first_scan->execute();
+
+  const auto predicates = std::vector<ScanPredicate>{{ColumnID{1}, ScanType::OpLessThanEquals, "name_4"},
+                                                     {ColumnID{0}, ScanType::OpLessThan, 720},
+                                                     {ColumnID{2}, ScanType::OpGreaterThan, 1.0f}};
+  auto scan = std::make_shared<ConjunctiveTableScan>(first_scan, predicates);
+  scan->set_max_thread_count(1);
+  scan->execute();
+  expect_same_rows(*scan->get_output(), *scan_one_by_one(first_scan, predicates));
+  EXPECT_GT(scan->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, EmptyResult) {
+  // the second predicate prunes all chunks but the last one, which has no statistics
+  const auto predicates = std::vector<ScanPredicate>{{ColumnID{1}, ScanType::OpNotEquals, "name_3"},
+                                                     {ColumnID{0}, ScanType::OpGreaterThan, 5000}};
+  auto scan = std::make_shared<ConjunctiveTableScan>(_table_wrapper, predicates);
+  scan->execute();
+
+  const auto& output = *scan->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  ASSERT_EQ(output.chunk_count(), 1u);
+  EXPECT_EQ(output.column_count(), 3u);
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, EvaluationOrder) {
+  const auto predicates = std::vector<ScanPredicate>{{ColumnID{2}, ScanType::OpNotEquals, 2.0f},
+                                                     {ColumnID{0}, ScanType::OpGreaterThanEquals, 700},
+                                                     {ColumnID{1}, ScanType::OpEquals, "name_3"}};
+  const auto scan = ConjunctiveTableScan{_table_wrapper, predicates};
+  EXPECT_EQ(scan.predicates()[0].column_id, ColumnID{2});
+
+  const auto expect_order = [&](const Table& input_table) {
+    const auto order = scan.evaluation_order(input_table);
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[0].column_id, ColumnID{1});
+    EXPECT_EQ(order[1].column_id, ColumnID{0});
+    EXPECT_EQ(order[2].column_id, ColumnID{2});
+  };
+  expect_order(*_table_wrapper->get_output());
+
+  // the statistics of the referenced table are used for ReferenceSegments
+  auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 990);
+  first_scan->execute();
+  expect_order(*first_scan->get_output());
+
+  // without statistics, the predicates keep their order
+  auto table = Table{};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  table.add_column("c", "float");
+  table.append({1, "x", 1.0f});
+  EXPECT_EQ(scan.evaluation_order(table)[0].column_id, ColumnID{2});
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, InvalidPredicates) {
+  EXPECT_THROW(ConjunctiveTableScan(_table_wrapper, {}), std::logic_error);
+  EXPECT_THROW(ConjunctiveTableScan(_table_wrapper, {{ColumnID{0}, ScanType::OpBetween, 1}}), std::logic_error);
+}
+
+}  // namespace opossum
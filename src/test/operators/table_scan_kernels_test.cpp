@@ -0,0 +1,146 @@
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan_kernels.hpp"
+#include "types.hpp"
+#include "utils/scan_type_utils.hpp"
+
+namespace opossum {
+
+class OperatorsTableScanKernelsTest : public BaseTest {
+ protected:
+  // checks that every kernel finds the same matches as the comparison operators, for each scan type and search value.
+  // The values are scanned from different start positions, so that kernels also begin and end within a register.
+  template <typename T>
+  void check_all_kernels(const std::vector<T>& values, const std::vector<T>& search_values) {
+    const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                             ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+    for (const auto kernel : {ScanKernel::Scalar, ScanKernel::Avx2, ScanKernel::Avx512}) {
+      if (!is_supported(kernel)) continue;
+
+      for (const auto scan_type : scan_types) {
+        for (const auto search_value : search_values) {
+          for (const auto begin : {size_t{0}, size_t{5}}) {
+            auto expected_matches = std::vector<ChunkOffset>{};
+            with_comparator(scan_type, [&](auto comparator) {
+              for (auto index = begin; index < values.size(); ++index) {
+                if (comparator(values[index], search_value)) {
+                  expected_matches.push_back(static_cast<ChunkOffset>(index));
+                }
+              }
+            });
+
+            auto matches = std::vector<ChunkOffset>(values.size() - begin);
+            const auto match_count = scan_values(values.data() + begin, values.size() - begin, scan_type, search_value,
+                                                 static_cast<ChunkOffset>(begin), matches.data(), kernel);
+            matches.resize(match_count);
+            ASSERT_EQ(matches, expected_matches) << "kernel " << static_cast<int>(kernel) << ", scan type "
+                                                 << static_cast<int>(scan_type) << ", search value " << search_value;
+          }
+        }
+      }
+    }
+  }
+
+  // same as check_all_kernels(), for scans between each pair of bounds with all combinations of inclusive bounds
+  template <typename T>
+  void check_all_kernels_between(const std::vector<T>& values, const std::vector<T>& bounds) {
+    for (const auto kernel : {ScanKernel::Scalar, ScanKernel::Avx2, ScanKernel::Avx512}) {
+      if (!is_supported(kernel)) continue;
+
+      for (const auto lower_value : bounds) {
+        for (const auto upper_value : bounds) {
+          for (const auto lower_is_inclusive : {false, true}) {
+            for (const auto upper_is_inclusive : {false, true}) {
+              auto expected_matches = std::vector<ChunkOffset>{};
+              with_between_comparator(lower_is_inclusive, upper_is_inclusive, [&](auto is_between) {
+                for (auto index = size_t{0}; index < values.size(); ++index) {
+                  if (is_between(values[index], lower_value, upper_value)) {
+                    expected_matches.push_back(static_cast<ChunkOffset>(index));
+                  }
+                }
+              });
+
+              auto matches = std::vector<ChunkOffset>(values.size());
+              const auto match_count =
+                  scan_values_between(values.data(), values.size(), lower_value, upper_value, lower_is_inclusive,
+                                      upper_is_inclusive, ChunkOffset{0}, matches.data(), kernel);
+              matches.resize(match_count);
+              ASSERT_EQ(matches, expected_matches)
+                  << "kernel " << static_cast<int>(kernel) << ", bounds " << lower_value << " and " << upper_value
+                  << ", inclusive " << lower_is_inclusive << " and " << upper_is_inclusive;
+            }
+          }
+        }
+      }
+    }
+  }
+};
+
+TEST_F(OperatorsTableScanKernelsTest, SelectedKernelIsSupported) { EXPECT_TRUE(is_supported(scan_kernel())); }
+
+TEST_F(OperatorsTableScanKernelsTest, ValueIDs) {
+  auto values_8 = std::vector<uint8_t>{};
+  auto values_16 = std::vector<uint16_t>{};
+  auto values_32 = std::vector<uint32_t>{};
+  for (auto index = uint32_t{0}; index < 203; ++index) {
+    values_8.push_back(static_cast<uint8_t>((index * 37) % 256));
+    values_16.push_back(static_cast<uint16_t>((index * 7919) % 65536));
+    // value ids with the highest bit set must not be compared as negative numbers
+    values_32.push_back(index * 2654435761u);
+  }
+
+  check_all_kernels<uint8_t>(values_8, {0, 1, 37, 128, 255});
+  check_all_kernels<uint16_t>(values_16, {0, 7919, 32768, 65535});
+  check_all_kernels<uint32_t>(values_32, {0, 2654435761u, 0x80000000, std::numeric_limits<uint32_t>::max()});
+}
+
+TEST_F(OperatorsTableScanKernelsTest, Values) {
+  auto int_values = std::vector<int32_t>{};
+  auto float_values = std::vector<float>{};
+  auto double_values = std::vector<double>{};
+  for (auto index = 0; index < 203; ++index) {
+    int_values.push_back((index * 7919) % 101 - 50);
+    float_values.push_back(static_cast<float>((index * 7919) % 101) * 0.5f - 25.0f);
+    double_values.push_back(((index * 7919) % 101) * 0.25 - 12.5);
+  }
+  int_values[17] = std::numeric_limits<int32_t>::min();
+  int_values[18] = std::numeric_limits<int32_t>::max();
+
+  // NaN only matches OpNotEquals
+  float_values[9] = std::nanf("");
+  double_values[9] = std::nan("");
+
+  check_all_kernels<int32_t>(int_values, {-50, 0, 3, 50, std::numeric_limits<int32_t>::min()});
+  check_all_kernels<float>(float_values, {-25.0f, 0.0f, 0.25f, 25.0f});
+  check_all_kernels<double>(double_values, {-12.5, 0.0, 0.3, 12.5});
+}
+
+TEST_F(OperatorsTableScanKernelsTest, Between) {
+  auto values_8 = std::vector<uint8_t>{};
+  auto values_32 = std::vector<uint32_t>{};
+  auto int_values = std::vector<int32_t>{};
+  auto double_values = std::vector<double>{};
+  for (auto index = uint32_t{0}; index < 75; ++index) {
+    values_8.push_back(static_cast<uint8_t>((index * 37) % 256));
+    values_32.push_back(index * 2654435761u);
+    int_values.push_back(static_cast<int32_t>((index * 7919) % 101) - 50);
+    double_values.push_back(((index * 7919) % 101) * 0.25 - 12.5);
+  }
+  // NaN is never between two bounds
+  double_values[9] = std::nan("");
+
+  check_all_kernels_between<uint8_t>(values_8, {0, 37, 200, 255});
+  check_all_kernels_between<uint32_t>(values_32, {0, 0x7FFFFFFF, 0x80000000, std::numeric_limits<uint32_t>::max()});
+  check_all_kernels_between<int32_t>(int_values, {-50, -3, 0, 17, 50});
+  check_all_kernels_between<double>(double_values, {-12.5, 0.0, 0.3, 12.5});
+  check_all_kernels_between<float>({1.0f, 2.0f, 2.5f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 2.0f, 3.0f, 2.5f, 9.0f, 1.0f,
+                                    0.5f, 2.0f, 3.0f},
+                                   {2.0f, 2.5f, 3.0f});
+}
+
+}  // namespace opossum
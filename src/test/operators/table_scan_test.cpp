@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -13,258 +14,550 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/cold_segment.hpp"
+#include "storage/group_key_index.hpp"
+#include "storage/hash_index.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 #include "types.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
 
-// class OperatorsTableScanTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
-//     _table_wrapper->execute();
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
 
-//     std::shared_ptr<Table> test_even_dict = std::make_shared<Table>(5);
-//     test_even_dict->add_column("a", "int");
-//     test_even_dict->add_column("b", "int");
-//     for (int i = 0; i <= 24; i += 2) test_even_dict->append({i, 100 + i});
+    std::shared_ptr<Table> test_even_dict = std::make_shared<Table>(5);
+    test_even_dict->add_column("a", "int");
+    test_even_dict->add_column("b", "int");
+    for (int i = 0; i <= 24; i += 2) test_even_dict->append({i, 100 + i});
 
-//     test_even_dict->compress_chunk(ChunkID(0));
-//     test_even_dict->compress_chunk(ChunkID(1));
+    test_even_dict->compress_chunk(ChunkID(0));
+    test_even_dict->compress_chunk(ChunkID(1));
 
-//     _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(test_even_dict));
-//     _table_wrapper_even_dict->execute();
-//   }
+    _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(test_even_dict));
+    _table_wrapper_even_dict->execute();
+  }
 
-//   std::shared_ptr<TableWrapper> get_table_op_part_dict() {
-//     auto table = std::make_shared<Table>(5);
-//     table->add_column("a", "int");
-//     table->add_column("b", "float");
+  std::shared_ptr<TableWrapper> get_table_op_part_dict() {
+    auto table = std::make_shared<Table>(5);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
 
-//     for (int i = 1; i < 20; ++i) {
-//       table->append({i, 100.1 + i});
-//     }
+    for (int i = 1; i < 20; ++i) {
+      table->append({i, 100.1 + i});
+    }
 
-//     table->compress_chunk(ChunkID(0));
-//     table->compress_chunk(ChunkID(1));
+    table->compress_chunk(ChunkID(0));
+    table->compress_chunk(ChunkID(1));
 
-//     auto table_wrapper = std::make_shared<TableWrapper>(table);
-//     table_wrapper->execute();
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
 
-//     return table_wrapper;
-//   }
+    return table_wrapper;
+  }
 
-//   std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int num_entries) {
-//     // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
-//     auto table = std::make_shared<opossum::Table>(0);
-//     table->add_column("a", "int");
-//     table->add_column("b", "float");
+  std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int num_entries) {
+    // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
+    auto table = std::make_shared<opossum::Table>(0);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
 
-//     for (int i = 0; i <= num_entries; i++) {
-//       table->append({i, 100.0f + i});
-//     }
+    for (int i = 0; i <= num_entries; i++) {
+      table->append({i, 100.0f + i});
+    }
 
-//     table->compress_chunk(ChunkID(0));
-
-//     auto table_wrapper = std::make_shared<opossum::TableWrapper>(std::move(table));
-//     table_wrapper->execute();
-//     return table_wrapper;
-//   }
+    table->compress_chunk(ChunkID(0));
+
+    auto table_wrapper = std::make_shared<opossum::TableWrapper>(std::move(table));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
 
-//   void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
-//                         std::vector<AllTypeVariant> expected) {
-//     for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
-//       const auto& chunk = table->get_chunk(chunk_id);
+  void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
+                        std::vector<AllTypeVariant> expected) {
+    for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
 
-//       for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk.size(); ++chunk_offset) {
-//         const auto& segment = *chunk.get_segment(column_id);
+      for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk.size(); ++chunk_offset) {
+        const auto& segment = *chunk.get_segment(column_id);
 
-//         const auto found_value = segment[chunk_offset];
-//         const auto comparator = [found_value](const AllTypeVariant expected_value) {
-//           // returns equivalency, not equality to simulate std::multiset.
-//           // multiset cannot be used because it triggers a compiler / lib bug when built in CI
-//           return !(found_value < expected_value) && !(expected_value < found_value);
-//         };
-
-//         auto search = std::find_if(expected.begin(), expected.end(), comparator);
-
-//         ASSERT_TRUE(search != expected.end());
-//         expected.erase(search);
-//       }
-//     }
-
-//     ASSERT_EQ(expected.size(), 0u);
-//   }
-
-//   std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
-// };
-
-// TEST_F(OperatorsTableScanTest, DoubleScan) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
-
-//   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
-//   scan_1->execute();
-
-//   auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
-//   scan_2->execute();
-
-//   EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, EmptyResultScan) {
-//   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
-//   scan_1->execute();
-
-//   for (auto i = ChunkID{0}; i < scan_1->get_output()->chunk_count(); i++)
-//     EXPECT_EQ(scan_1->get_output()->get_chunk(i).column_count(), 2u);
-// }
-
-// TEST_F(OperatorsTableScanTest, SingleScanReturnsCorrectRowCount) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
-
-//   auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
-//   scan->execute();
-
-//   EXPECT_TABLE_EQ(scan->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumn) {
-//   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {104};
-//   tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpLessThan] = {100, 102};
-//   tests[ScanType::OpLessThanEquals] = {100, 102, 104};
-//   tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 4);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
-//   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {104};
-//   tests[ScanType::OpNotEquals] = {100, 102, 106};
-//   tests[ScanType::OpLessThan] = {100, 102};
-//   tests[ScanType::OpLessThanEquals] = {100, 102, 104};
-//   tests[ScanType::OpGreaterThan] = {106};
-//   tests[ScanType::OpGreaterThanEquals] = {104, 106};
-//   for (const auto& test : tests) {
-//     auto scan1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{1}, ScanType::OpLessThan, 108);
-//     scan1->execute();
-
-//     auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{0}, test.first, 4);
-//     scan2->execute();
-
-//     ASSERT_COLUMN_EQ(scan2->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
-
-//   auto table_wrapper = get_table_op_part_dict();
-//   auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
-//   scan_1->execute();
-
-//   EXPECT_TABLE_EQ(scan_1->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueGreaterThanMaxDictionaryValue) {
-//   const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   const auto no_rows = std::vector<AllTypeVariant>{};
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = no_rows;
-//   tests[ScanType::OpNotEquals] = all_rows;
-//   tests[ScanType::OpLessThan] = all_rows;
-//   tests[ScanType::OpLessThanEquals] = all_rows;
-//   tests[ScanType::OpGreaterThan] = no_rows;
-//   tests[ScanType::OpGreaterThanEquals] = no_rows;
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 30);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueLessThanMinDictionaryValue) {
-//   const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   const auto no_rows = std::vector<AllTypeVariant>{};
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = no_rows;
-//   tests[ScanType::OpNotEquals] = all_rows;
-//   tests[ScanType::OpLessThan] = no_rows;
-//   tests[ScanType::OpLessThanEquals] = no_rows;
-//   tests[ScanType::OpGreaterThan] = all_rows;
-//   tests[ScanType::OpGreaterThanEquals] = all_rows;
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0} /* "a" */, test.first, -10);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
-//   // scanning for a value that is around the dictionary's bounds
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {100};
-//   tests[ScanType::OpLessThan] = {};
-//   tests[ScanType::OpLessThanEquals] = {100};
-//   tests[ScanType::OpGreaterThan] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpGreaterThanEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpNotEquals] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 0);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
-//   auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
-//   scan_1->execute();
-//   EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(0));
-
-//   // scan_1 produced an empty result
-//   auto scan_2 = std::make_shared<opossum::TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 456.7);
-//   scan_2->execute();
-
-//   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(0));
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnWideDictionarySegment) {
-//   // 2**8 + 1 values require a data type of 16bit.
-//   const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
-//   auto scan_1 = std::make_shared<opossum::TableScan>(table_wrapper_dict_16, ColumnID{0}, ScanType::OpGreaterThan, 200);
-//   scan_1->execute();
-
-//   EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(57));
-
-//   // 2**16 + 1 values require a data type of 32bit.
-//   const auto table_wrapper_dict_32 = get_table_op_with_n_dict_entries((1 << 16) + 1);
-//   auto scan_2 =
-//       std::make_shared<opossum::TableScan>(table_wrapper_dict_32, ColumnID{0}, ScanType::OpGreaterThan, 65500);
-//   scan_2->execute();
-
-//   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
-// }
+        const auto found_value = segment[chunk_offset];
+        const auto comparator = [found_value](const AllTypeVariant expected_value) {
+          // returns equivalency, not equality to simulate std::multiset.
+          // multiset cannot be used because it triggers a compiler / lib bug when built in CI
+          return !(found_value < expected_value) && !(expected_value < found_value);
+        };
+
+        auto search = std::find_if(expected.begin(), expected.end(), comparator);
+
+        ASSERT_TRUE(search != expected.end());
+        expected.erase(search);
+      }
+    }
+
+    ASSERT_EQ(expected.size(), 0u);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
+};
+
+TEST_F(OperatorsTableScanTest, DoubleScan) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
+
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan_1->execute();
+
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
+  scan_2->execute();
+
+  EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, EmptyResultScan) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
+  scan_1->execute();
+
+  for (auto i = ChunkID{0}; i < scan_1->get_output()->chunk_count(); i++)
+    EXPECT_EQ(scan_1->get_output()->get_chunk(i).column_count(), 2u);
+}
+
+TEST_F(OperatorsTableScanTest, SingleScanReturnsCorrectRowCount) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan->execute();
+
+  EXPECT_TABLE_EQ(scan->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumn) {
+  // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 4);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
+  // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106};
+  for (const auto& test : tests) {
+    auto scan1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{1}, ScanType::OpLessThan, 108);
+    scan1->execute();
+
+    auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{0}, test.first, 4);
+    scan2->execute();
+
+    ASSERT_COLUMN_EQ(scan2->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
+
+  auto table_wrapper = get_table_op_part_dict();
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+  scan_1->execute();
+
+  EXPECT_TABLE_EQ(scan_1->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueGreaterThanMaxDictionaryValue) {
+  const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  const auto no_rows = std::vector<AllTypeVariant>{};
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = no_rows;
+  tests[ScanType::OpNotEquals] = all_rows;
+  tests[ScanType::OpLessThan] = all_rows;
+  tests[ScanType::OpLessThanEquals] = all_rows;
+  tests[ScanType::OpGreaterThan] = no_rows;
+  tests[ScanType::OpGreaterThanEquals] = no_rows;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 30);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueLessThanMinDictionaryValue) {
+  const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  const auto no_rows = std::vector<AllTypeVariant>{};
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = no_rows;
+  tests[ScanType::OpNotEquals] = all_rows;
+  tests[ScanType::OpLessThan] = no_rows;
+  tests[ScanType::OpLessThanEquals] = no_rows;
+  tests[ScanType::OpGreaterThan] = all_rows;
+  tests[ScanType::OpGreaterThanEquals] = all_rows;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0} /* "a" */, test.first, -10);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
+  // scanning for a value that is around the dictionary's bounds
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {100};
+  tests[ScanType::OpLessThan] = {};
+  tests[ScanType::OpLessThanEquals] = {100};
+  tests[ScanType::OpGreaterThan] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpNotEquals] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 0);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
+  auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
+  scan_1->execute();
+  EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(0));
+
+  // scan_1 produced an empty result
+  auto scan_2 = std::make_shared<opossum::TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 456.7);
+  scan_2->execute();
+
+  EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(0));
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnWideDictionarySegment) {
+  // 2**8 + 1 values require a data type of 16bit.
+  const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
+  auto scan_1 = std::make_shared<opossum::TableScan>(table_wrapper_dict_16, ColumnID{0}, ScanType::OpGreaterThan, 200);
+  scan_1->execute();
+
+  EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(57));
+
+  // 2**16 + 1 values require a data type of 32bit.
+  const auto table_wrapper_dict_32 = get_table_op_with_n_dict_entries((1 << 16) + 1);
+  auto scan_2 =
+      std::make_shared<opossum::TableScan>(table_wrapper_dict_32, ColumnID{0}, ScanType::OpGreaterThan, 65500);
+  scan_2->execute();
+
+  EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
+}
+
+TEST_F(OperatorsTableScanTest, SkipsChunksByStatistics) {
+  // chunk 0 holds 0 to 8, chunk 1 holds 10 to 18 and chunk 2, which is not compressed, holds 20 to 24
+  const auto& table = *_table_wrapper_even_dict->get_output();
+  const auto last_access_0 = table.get_chunk(ChunkID{0}).last_access();
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThanEquals, 12);
+  scan->execute();
+
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, {112, 114, 116, 118, 120, 122, 124});
+  EXPECT_EQ(scan->get_output()->chunk_count(), 2u);
+
+  // the first chunk's values are all smaller than 12, so it has not been read
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).last_access(), last_access_0);
+  EXPECT_GE(table.get_chunk(ChunkID{1}).last_access(), last_access_0);
+}
+
+TEST_F(OperatorsTableScanTest, ScanSortedChunks) {
+  // the first column is sorted and contains duplicates, the second one is not sorted
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (auto i = 0; i < 30; ++i) table->append({i / 3, 30 - i});
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, {SegmentEncodingSpec{EncodingType::RunLength}, SegmentEncodingSpec{}});
+  EXPECT_TRUE(table->get_chunk(ChunkID{0}).is_sorted_by(ColumnID{0}));
+  EXPECT_FALSE(table->get_chunk(ChunkID{0}).is_sorted_by(ColumnID{1}));
+  EXPECT_TRUE(table->get_chunk(ChunkID{1}).is_sorted_by(ColumnID{0}));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {15, 14, 13};
+  tests[ScanType::OpNotEquals] = {30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+                                  12, 11, 10, 9,  8,  7,  6,  5,  4,  3,  2,  1};
+  tests[ScanType::OpLessThan] = {30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16};
+  tests[ScanType::OpLessThanEquals] = {30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13};
+  tests[ScanType::OpGreaterThan] = {12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1};
+  tests[ScanType::OpGreaterThanEquals] = {15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 5);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+
+  // the matches of a sorted chunk form a contiguous range
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1);
+  scan->execute();
+  const auto& output_chunk = scan->get_output()->get_chunk(ChunkID{0});
+  const auto reference_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output_chunk.get_segment(ColumnID{0}));
+  const auto expected_pos_list = PosList{{ChunkID{0}, 3}, {ChunkID{0}, 4}, {ChunkID{0}, 5}, {ChunkID{0}, 6},
+                                         {ChunkID{0}, 7}, {ChunkID{0}, 8}, {ChunkID{0}, 9}};
+  EXPECT_EQ(*reference_segment->pos_list(), expected_pos_list);
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithIndex) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (auto i = 0; i < 20; ++i) table->append({(i * 7) % 10, i});
+  table->compress_chunk(ChunkID{0});
+  table->get_chunk(ChunkID{0}).create_index<GroupKeyIndex>(ColumnID{0});
+  // the hash index of the second chunk is only used for OpEquals
+  table->get_chunk(ChunkID{1}).create_index<HashIndex<int>>(ColumnID{0});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {9, 19};
+  tests[ScanType::OpNotEquals] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 16, 17, 18};
+  tests[ScanType::OpLessThan] = {0, 3, 6, 10, 13, 16};
+  tests[ScanType::OpLessThanEquals] = {0, 3, 6, 9, 10, 13, 16, 19};
+  tests[ScanType::OpGreaterThan] = {1, 2, 4, 5, 7, 8, 11, 12, 14, 15, 17, 18};
+  tests[ScanType::OpGreaterThanEquals] = {1, 2, 4, 5, 7, 8, 9, 11, 12, 14, 15, 17, 18, 19};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 3);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanBetween) {
+  // the chunks are dictionary encoded with an index, dictionary encoded, run-length encoded, sorted, dictionary
+  // encoded with bit-packed value ids and unencoded
+  auto table = std::make_shared<Table>(8);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  auto values = std::vector<int>{};
+  for (auto i = 0; i < 44; ++i) {
+    values.push_back(i >= 24 && i < 32 ? (i - 24) * 13 / 8 : (i * 7) % 13);
+    table->append({values.back(), i});
+  }
+  table->compress_chunk(ChunkID{0});
+  table->get_chunk(ChunkID{0}).create_index<GroupKeyIndex>(ColumnID{0});
+  table->compress_chunk(ChunkID{1});
+  table->compress_chunk(ChunkID{2}, {SegmentEncodingSpec{EncodingType::RunLength}, SegmentEncodingSpec{}});
+  table->compress_chunk(ChunkID{3});
+  EXPECT_TRUE(table->get_chunk(ChunkID{3}).is_sorted_by(ColumnID{0}));
+  table->compress_chunk(ChunkID{4}, {SegmentEncodingSpec{EncodingType::Dictionary, AttributeVectorEncoding::BitPacked},
+                                     SegmentEncodingSpec{}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  // the second scan reads the values through ReferenceSegments
+  auto reference_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpNotEquals, 5);
+  reference_scan->execute();
+
+  for (const auto lower_value : {-1, 0, 3, 6, 12}) {
+    for (const auto upper_value : {0, 3, 6, 12, 20}) {
+      for (const auto lower_is_inclusive : {false, true}) {
+        for (const auto upper_is_inclusive : {false, true}) {
+          auto expected = std::vector<AllTypeVariant>{};
+          auto expected_without_5 = std::vector<AllTypeVariant>{};
+          for (auto i = 0; i < 44; ++i) {
+            const auto above_lower = lower_is_inclusive ? values[i] >= lower_value : values[i] > lower_value;
+            const auto below_upper = upper_is_inclusive ? values[i] <= upper_value : values[i] < upper_value;
+            if (!above_lower || !below_upper) continue;
+            expected.push_back(i);
+            if (i != 5) expected_without_5.push_back(i);
+          }
+
+          auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, lower_value, upper_value,
+                                                  lower_is_inclusive, upper_is_inclusive);
+          scan->execute();
+          ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
+
+          auto scan_on_scan = std::make_shared<TableScan>(reference_scan, ColumnID{0}, lower_value, upper_value,
+                                                          lower_is_inclusive, upper_is_inclusive);
+          scan_on_scan->execute();
+          ASSERT_COLUMN_EQ(scan_on_scan->get_output(), ColumnID{1}, expected_without_5);
+        }
+      }
+    }
+  }
+
+  EXPECT_THROW(TableScan(table_wrapper, ColumnID{0}, ScanType::OpBetween, 3), std::logic_error);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictionaryValueIDs) {
+  // each chunk uses a different dictionary encoding, and "f" is in none of the dictionaries
+  auto table = std::make_shared<Table>(6);
+  table->add_column("a", "string");
+  table->add_column("b", "int");
+  for (auto i = 0; i < 18; ++i) table->append({std::string(1 + i % 2, static_cast<char>('a' + (i * 5) % 8)), i});
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, {SegmentEncodingSpec{EncodingType::Dictionary, AttributeVectorEncoding::BitPacked},
+                                     SegmentEncodingSpec{}});
+  table->compress_chunk(ChunkID{2}, {SegmentEncodingSpec{EncodingType::FrontCodedDictionary}, SegmentEncodingSpec{}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::map<std::pair<ScanType, std::string>, std::vector<AllTypeVariant>> tests;
+  tests[{ScanType::OpEquals, "dd"}] = {7, 15};
+  tests[{ScanType::OpEquals, "f"}] = {};
+  tests[{ScanType::OpNotEquals, "dd"}] = {0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 16, 17};
+  tests[{ScanType::OpNotEquals, "f"}] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+  tests[{ScanType::OpLessThan, "dd"}] = {0, 2, 5, 8, 10, 13, 16};
+  tests[{ScanType::OpLessThan, "f"}] = {0, 2, 4, 5, 7, 8, 10, 12, 13, 15, 16};
+  tests[{ScanType::OpLessThanEquals, "dd"}] = {0, 2, 5, 7, 8, 10, 13, 15, 16};
+  tests[{ScanType::OpLessThanEquals, "f"}] = {0, 2, 4, 5, 7, 8, 10, 12, 13, 15, 16};
+  tests[{ScanType::OpGreaterThan, "dd"}] = {1, 3, 4, 6, 9, 11, 12, 14, 17};
+  tests[{ScanType::OpGreaterThan, "f"}] = {1, 3, 6, 9, 11, 14, 17};
+  tests[{ScanType::OpGreaterThanEquals, "dd"}] = {1, 3, 4, 6, 7, 9, 11, 12, 14, 15, 17};
+  tests[{ScanType::OpGreaterThanEquals, "f"}] = {1, 3, 6, 9, 11, 14, 17};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first.first, test.first.second);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+
+  // scans on ReferenceSegments compare the value ids of the referenced segments
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, "b");
+  scan_1->execute();
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpNotEquals, "f");
+  scan_2->execute();
+  ASSERT_COLUMN_EQ(scan_2->get_output(), ColumnID{1}, {1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 13, 14, 15, 17});
+}
+
+TEST_F(OperatorsTableScanTest, ParallelScan) {
+  // enough rows for four threads, spread over chunks of different encodings
+  const auto chunk_size = TableScan::min_rows_per_thread / 2;
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", "int");
+  auto expected_row_count = size_t{0};
+  for (auto chunk_index = 0; chunk_index < 8; ++chunk_index) {
+    auto values = std::vector<int>(chunk_size);
+    for (auto index = size_t{0}; index < chunk_size; ++index) {
+      values[index] = static_cast<int>((index * 7919) % 1000);
+      expected_row_count += values[index] < 10;
+    }
+    auto chunk = Chunk{};
+    chunk.add_segment(std::make_shared<ValueSegment<int>>(std::move(values)));
+    table->emplace_chunk(std::move(chunk));
+  }
+  table->compress_chunk(ChunkID{1});
+  table->compress_chunk(ChunkID{6});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto single_threaded_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+  single_threaded_scan->set_max_thread_count(1);
+  single_threaded_scan->execute();
+  auto parallel_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+  parallel_scan->set_max_thread_count(4);
+  parallel_scan->execute();
+
+  // the output chunks are in the order of the input chunks, no matter which thread scanned them
+  const auto& output = *parallel_scan->get_output();
+  ASSERT_EQ(output.chunk_count(), 8u);
+  EXPECT_EQ(output.row_count(), expected_row_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto pos_list = [&](const Table& result) {
+      const auto segment = result.get_chunk(chunk_id).get_segment(ColumnID{0});
+      return std::dynamic_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+    };
+    EXPECT_EQ(*pos_list(output), *pos_list(*single_threaded_scan->get_output()));
+    EXPECT_EQ(pos_list(output)->front().chunk_id, chunk_id);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanKeepsOrderOfReferencedRows) {
+  // the chunks of the referenced table use different encodings: 0 3 6 2 | 5 1 4 0 | 3 6 2 5
+  auto referenced_table = std::make_shared<Table>(4);
+  referenced_table->add_column("a", "int");
+  for (auto i = 0; i < 12; ++i) referenced_table->append({(i * 3) % 7});
+  referenced_table->compress_chunk(ChunkID{0});
+  referenced_table->compress_chunk(ChunkID{2}, {SegmentEncodingSpec{EncodingType::RunLength}});
+
+  // the position list alternates between the referenced chunks
+  const auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{2}, 1},
+                                                          {ChunkID{0}, 3},
+                                                          {ChunkID{1}, 0},
+                                                          {ChunkID{0}, 0},
+                                                          {ChunkID{2}, 3},
+                                                          {ChunkID{1}, 2},
+                                                          {ChunkID{0}, 1},
+                                                          {ChunkID{2}, 0}});
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("a", "int");
+  auto chunk = Chunk{};
+  chunk.add_segment(std::make_shared<ReferenceSegment>(referenced_table, ColumnID{0}, pos_list));
+  table->emplace_chunk(std::move(chunk));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 3);
+  scan->execute();
+
+  const auto& output_segment = scan->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  const auto expected_pos_list = PosList{{ChunkID{2}, 1}, {ChunkID{1}, 0}, {ChunkID{2}, 3},
+                                         {ChunkID{1}, 2}, {ChunkID{0}, 1}, {ChunkID{2}, 0}};
+  EXPECT_EQ(*std::dynamic_pointer_cast<const ReferenceSegment>(output_segment)->pos_list(), expected_pos_list);
+}
+
+TEST_F(OperatorsTableScanTest, ScanColdChunks) {
+  // the first two chunks are demoted, the first one was dictionary encoded before: 0 3 6 2 | 5 1 4 0 | 3 6
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 10; ++i) table->append({(i * 3) % 7});
+  table->compress_chunk(ChunkID{0});
+  EXPECT_EQ(table->demote_cold_chunks(std::chrono::seconds{0}), 2u);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 3);
+  scan->execute();
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, {3, 6, 5, 4, 3, 6});
+
+  const auto cold_segment =
+      std::dynamic_pointer_cast<const ColdSegment>(table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(cold_segment);
+  EXPECT_TRUE(cold_segment->is_decompressed());
+
+  // positions in cold chunks are looked up in the rebuilt segments as well
+  table->demote_cold_chunks(std::chrono::seconds{0});
+  auto scan_2 = std::make_shared<TableScan>(scan, ColumnID{0}, ScanType::OpLessThan, 6);
+  scan_2->execute();
+  ASSERT_COLUMN_EQ(scan_2->get_output(), ColumnID{0}, {3, 5, 4, 3});
+  EXPECT_TRUE(cold_segment->is_decompressed());
+}
 
 }  // namespace opossum
@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/adaptive_radix_tree_index.hpp"
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/segment_encoding_utils.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    vc_str = std::make_shared<ValueSegment<std::string>>();
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox", "hot"}) {
+      vc_str->append(value);
+    }
+    index = std::make_shared<AdaptiveRadixTreeIndex<std::string>>(vc_str);
+  }
+
+  std::vector<ChunkOffset> scan(const ScanType scan_type, const AllTypeVariant& value) const {
+    auto matches = std::vector<ChunkOffset>{};
+    index->scan(scan_type, value, matches);
+    return matches;
+  }
+
+  // checks that the keys of the given values, which have to be sorted, are sorted as well
+  template <typename T>
+  void expect_ordered_keys(const std::vector<T>& sorted_values) {
+    for (auto index = size_t{1}; index < sorted_values.size(); ++index) {
+      EXPECT_LT(AdaptiveRadixTreeIndex<T>::binary_comparable_key(sorted_values[index - 1]),
+                AdaptiveRadixTreeIndex<T>::binary_comparable_key(sorted_values[index]));
+    }
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> vc_str;
+  std::shared_ptr<AdaptiveRadixTreeIndex<std::string>> index;
+};
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, BinaryComparableKeys) {
+  expect_ordered_keys<int32_t>({std::numeric_limits<int32_t>::min(), -256, -1, 0, 1, 255, 256,
+                                std::numeric_limits<int32_t>::max()});
+  expect_ordered_keys<int64_t>({std::numeric_limits<int64_t>::min(), -1, 0, int64_t{1} << 40,
+                                std::numeric_limits<int64_t>::max()});
+  expect_ordered_keys<float>({-std::numeric_limits<float>::infinity(), -2.5f, -1.0f, -0.5f, 0.0f, 0.25f, 1.0f,
+                              std::numeric_limits<float>::max()});
+  expect_ordered_keys<double>({std::numeric_limits<double>::lowest(), -1e-300, 0.0, 1e-300, 3.0, 1e300});
+  expect_ordered_keys<std::string>({"", std::string{"\0", 1}, std::string{"\0\0", 2}, "\x01", "a",
+                                    std::string{"a\0", 2}, "a\x01", "ab", "b", "\xff"});
+
+  EXPECT_EQ(AdaptiveRadixTreeIndex<int32_t>::binary_comparable_key(1), (AdaptiveRadixTree::Key{0x80, 0, 0, 1}));
+  EXPECT_EQ(AdaptiveRadixTreeIndex<double>::binary_comparable_key(-0.0),
+            AdaptiveRadixTreeIndex<double>::binary_comparable_key(0.0));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, PointLookup) {
+  auto matches = std::vector<ChunkOffset>{};
+  index->point_lookup("delta", matches);
+  EXPECT_EQ(matches, (std::vector<ChunkOffset>{1, 3}));
+
+  // "hot" is a prefix of "hotel", but their keys are not
+  matches.clear();
+  index->point_lookup("hot", matches);
+  EXPECT_EQ(matches, (std::vector<ChunkOffset>{8}));
+
+  matches.clear();
+  for (const auto& value : {"", "ho", "hote", "hotels", "zulu"}) index->point_lookup(value, matches);
+  EXPECT_TRUE(matches.empty());
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, Scan) {
+  EXPECT_EQ(scan(ScanType::OpEquals, "charlie"), (std::vector<ChunkOffset>{5, 6}));
+  EXPECT_EQ(scan(ScanType::OpNotEquals, "charlie"), (std::vector<ChunkOffset>{4, 1, 3, 2, 8, 0, 7}));
+  EXPECT_EQ(scan(ScanType::OpLessThan, "delta"), (std::vector<ChunkOffset>{4, 5, 6}));
+  EXPECT_EQ(scan(ScanType::OpLessThanEquals, "delta"), (std::vector<ChunkOffset>{4, 5, 6, 1, 3}));
+  EXPECT_EQ(scan(ScanType::OpGreaterThan, "hot"), (std::vector<ChunkOffset>{0, 7}));
+  EXPECT_EQ(scan(ScanType::OpGreaterThanEquals, "hot"), (std::vector<ChunkOffset>{8, 0, 7}));
+  EXPECT_EQ(scan(ScanType::OpGreaterThan, "hou"), (std::vector<ChunkOffset>{7}));
+  EXPECT_TRUE(scan(ScanType::OpLessThan, "apple").empty());
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, ManyValues) {
+  // enough distinct bytes per level to grow the nodes to all sizes
+  auto values = std::vector<int64_t>(5'000);
+  auto generator = std::mt19937{17};
+  auto distribution = std::uniform_int_distribution<int64_t>{-100'000, 100'000};
+  for (auto& value : values) value = distribution(generator);
+
+  const auto segment = std::make_shared<ValueSegment<int64_t>>(std::vector<int64_t>{values});
+  const auto dictionary_segment = encode_segment("long", segment, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto long_index = AdaptiveRadixTreeIndex<int64_t>{dictionary_segment};
+
+  const auto expected_matches = [&](const int64_t lower, const int64_t upper) {
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      if (values[chunk_offset] >= lower && values[chunk_offset] <= upper) chunk_offsets.push_back(chunk_offset);
+    }
+    return chunk_offsets;
+  };
+
+  for (const auto& bounds : {std::make_pair(int64_t{-500}, int64_t{500}), std::make_pair(int64_t{-100'000}, int64_t{0}),
+                             std::make_pair(values[0], values[0]), std::make_pair(int64_t{7}, int64_t{-7})}) {
+    auto matches = std::vector<ChunkOffset>{};
+    long_index.range_lookup({bounds.first, true}, {bounds.second, true}, matches);
+
+    // matches are ordered by value
+    EXPECT_TRUE(std::is_sorted(matches.cbegin(), matches.cend(), [&](const ChunkOffset lhs, const ChunkOffset rhs) {
+      return values[lhs] < values[rhs];
+    }));
+    std::sort(matches.begin(), matches.end());
+    EXPECT_EQ(matches, expected_matches(bounds.first, bounds.second));
+  }
+
+  auto all_matches = std::vector<ChunkOffset>{};
+  long_index.range_lookup({std::nullopt, true}, {std::nullopt, true}, all_matches);
+  EXPECT_EQ(all_matches.size(), values.size());
+  EXPECT_GT(long_index.estimate_memory_usage(), values.size() * sizeof(ChunkOffset));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, FloatingPointRanges) {
+  const auto segment = std::make_shared<ValueSegment<float>>(std::vector<float>{2.5f, -1.5f, 0.0f, -0.0f, -3.0f, 1.0f});
+  const auto float_index = AdaptiveRadixTreeIndex<float>{segment};
+
+  auto matches = std::vector<ChunkOffset>{};
+  float_index.range_lookup({-2.0f, true}, {1.0f, false}, matches);
+  EXPECT_EQ(matches, (std::vector<ChunkOffset>{1, 2, 3}));
+
+  matches.clear();
+  float_index.point_lookup(0.0f, matches);
+  EXPECT_EQ(matches, (std::vector<ChunkOffset>{2, 3}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, InsertsAppendedRows) {
+  auto chunk = Chunk{};
+  chunk.add_segment(std::make_shared<ValueSegment<int>>());
+  chunk.add_segment(std::make_shared<ValueSegment<std::string>>());
+  chunk.append({3, "x"});
+
+  const auto chunk_index = chunk.create_index<AdaptiveRadixTreeIndex<int>>(ColumnID{0});
+  EXPECT_EQ(chunk.get_index(ColumnID{0}, SegmentIndexType::AdaptiveRadixTree), chunk_index);
+  EXPECT_EQ(chunk.get_index(ColumnID{1}, SegmentIndexType::AdaptiveRadixTree), nullptr);
+
+  chunk.append({5, "y"});
+  chunk.append({3, "z"});
+
+  auto matches = std::vector<ChunkOffset>{};
+  chunk_index->point_lookup(3, matches);
+  EXPECT_EQ(matches, (std::vector<ChunkOffset>{0, 2}));
+
+  matches.clear();
+  chunk_index->scan(ScanType::OpGreaterThan, 3, matches);
+  EXPECT_EQ(matches, (std::vector<ChunkOffset>{1}));
+}
+
+}  // namespace opossum
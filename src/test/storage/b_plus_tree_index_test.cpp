@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/b_plus_tree_index.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageBPlusTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(4);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->append({3, "x"});
+    table->append({1, "y"});
+    table->append({3, "a"});
+    table->append({2, "x"});
+    table->append({1, "x"});
+    table->append({3, "x"});
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(StorageBPlusTreeIndexTest, PointLookup) {
+  const auto index = table->create_b_plus_tree_index({ColumnID{0}});
+  EXPECT_EQ(index->size(), 6u);
+  EXPECT_EQ(table->get_b_plus_tree_index({ColumnID{0}}), index);
+  EXPECT_EQ(table->get_b_plus_tree_index({ColumnID{1}}), nullptr);
+
+  // rows with equal keys keep their order
+  EXPECT_EQ(*index->point_lookup({3}), (PosList{{ChunkID{0}, 0}, {ChunkID{0}, 2}, {ChunkID{1}, 1}}));
+  EXPECT_EQ(*index->point_lookup({2}), (PosList{{ChunkID{0}, 3}}));
+  EXPECT_TRUE(index->point_lookup({4})->empty());
+}
+
+TEST_F(StorageBPlusTreeIndexTest, RangeLookup) {
+  const auto index = table->create_b_plus_tree_index({ColumnID{0}});
+  EXPECT_EQ(*index->range_lookup({2}, true, {3}, false), (PosList{{ChunkID{0}, 3}}));
+  EXPECT_EQ(*index->range_lookup({1}, false, {}, true),
+            (PosList{{ChunkID{0}, 3}, {ChunkID{0}, 0}, {ChunkID{0}, 2}, {ChunkID{1}, 1}}));
+  EXPECT_EQ(*index->range_lookup({}, true, {1}, true), (PosList{{ChunkID{0}, 1}, {ChunkID{1}, 0}}));
+  EXPECT_EQ(index->range_lookup({}, true, {}, true)->size(), 6u);
+  EXPECT_TRUE(index->range_lookup({3}, true, {2}, true)->empty());
+}
+
+TEST_F(StorageBPlusTreeIndexTest, CompositeKey) {
+  const auto index = table->create_b_plus_tree_index({ColumnID{1}, ColumnID{0}});
+  EXPECT_EQ(*index->point_lookup({"x", 3}), (PosList{{ChunkID{0}, 0}, {ChunkID{1}, 1}}));
+
+  // fewer values than key columns match the leading columns
+  EXPECT_EQ(*index->point_lookup({"x"}), (PosList{{ChunkID{1}, 0}, {ChunkID{0}, 3}, {ChunkID{0}, 0}, {ChunkID{1}, 1}}));
+  EXPECT_EQ(*index->range_lookup({"x", 1}, false, {"x"}, true),
+            (PosList{{ChunkID{0}, 3}, {ChunkID{0}, 0}, {ChunkID{1}, 1}}));
+  EXPECT_EQ(*index->range_lookup({"a"}, false, {"x"}, false), (PosList{}));
+  EXPECT_EQ(index->range_lookup({"a"}, false, {"x"}, true)->size(), 4u);
+  EXPECT_THROW(index->point_lookup({"x", 3, 4}), std::logic_error);
+}
+
+TEST_F(StorageBPlusTreeIndexTest, MaintainedByTable) {
+  const auto index = table->create_b_plus_tree_index({ColumnID{0}});
+  table->compress_chunk(ChunkID{0});
+  table->append({2, "z"});
+  EXPECT_EQ(*index->point_lookup({2}), (PosList{{ChunkID{0}, 3}, {ChunkID{1}, 2}}));
+
+  // compress_chunk replaces the segments of a chunk, but the rows keep their positions
+  table->compress_chunk(ChunkID{1});
+  EXPECT_EQ(table->get_chunk(ChunkID{1}).get_segment(ColumnID{0})->operator[](2), AllTypeVariant{2});
+  EXPECT_EQ(*index->point_lookup({2}), (PosList{{ChunkID{0}, 3}, {ChunkID{1}, 2}}));
+
+  auto chunk = Chunk{};
+  chunk.add_segment(std::make_shared<ValueSegment<int>>(std::vector<int>{2, 5}));
+  chunk.add_segment(std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"u", "v"}));
+  table->emplace_chunk(std::move(chunk));
+  EXPECT_EQ(*index->point_lookup({2}), (PosList{{ChunkID{0}, 3}, {ChunkID{1}, 2}, {ChunkID{2}, 0}}));
+}
+
+TEST_F(StorageBPlusTreeIndexTest, ManyRows) {
+  // enough rows to split leaves and inner nodes several times
+  auto large_table = Table{1'000};
+  large_table.add_column("a", "long");
+  large_table.add_column("b", "double");
+  const auto row_count = 20'000;
+  for (auto row = 0; row < row_count; ++row) large_table.append({int64_t{(row * 7'919) % 5'000}, row * 0.5});
+  const auto index = large_table.create_b_plus_tree_index({ColumnID{0}, ColumnID{1}});
+  for (auto row = row_count; row < row_count + 1'000; ++row) large_table.append({int64_t{row % 5'000}, -1.0 * row});
+  EXPECT_EQ(index->size(), 21'000u);
+
+  // each value of the first column occurs four times in the first rows and once in the appended ones
+  const auto pos_list = index->range_lookup({int64_t{100}}, true, {int64_t{199}}, true);
+  EXPECT_EQ(pos_list->size(), 100u * 4 + 100);
+  auto previous = std::make_pair(int64_t{0}, 0.0);
+  for (const auto& row_id : *pos_list) {
+    const auto& chunk = large_table.get_chunk(row_id.chunk_id);
+    const auto current = std::make_pair(type_cast<int64_t>((*chunk.get_segment(ColumnID{0}))[row_id.chunk_offset]),
+                                        type_cast<double>((*chunk.get_segment(ColumnID{1}))[row_id.chunk_offset]));
+    EXPECT_GE(current.first, 100);
+    EXPECT_LE(current.first, 199);
+    if (&row_id != &pos_list->front()) {
+      EXPECT_LE(previous, current);
+    }
+    previous = current;
+  }
+
+  EXPECT_EQ(index->point_lookup({int64_t{150}, -20'150.0})->size(), 1u);
+  EXPECT_GT(index->estimate_memory_usage(), 21'000 * sizeof(RowID));
+}
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class StorageBitPackedAttributeVectorTest : public BaseTest {};
+
+TEST_F(StorageBitPackedAttributeVectorTest, RequiredBitWidth) {
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(ValueID{0}), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(ValueID{1}), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(ValueID{2}), 2u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(ValueID{299}), 9u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(ValueID{512}), 10u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(ValueID{std::numeric_limits<uint32_t>::max()}), 32u);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, SetAndGetAllBitWidths) {
+  for (auto bit_width = uint8_t{1}; bit_width <= 32; ++bit_width) {
+    const auto size = size_t{200};
+    const auto max_value = bit_width == 32 ? std::numeric_limits<uint32_t>::max() : (uint32_t{1} << bit_width) - 1;
+    BitPackedAttributeVector attribute_vector{size, bit_width};
+
+    for (auto position = size_t{0}; position < size; ++position) {
+      attribute_vector.set(position, ValueID{static_cast<uint32_t>((position * 2654435761u) & max_value)});
+    }
+
+    // overwriting must not touch the neighbouring values
+    attribute_vector.set(size / 2, ValueID{max_value});
+    attribute_vector.set(size / 2, ValueID{0});
+
+    for (auto position = size_t{0}; position < size; ++position) {
+      const auto expected = position == size / 2 ? 0u : static_cast<uint32_t>((position * 2654435761u) & max_value);
+      ASSERT_EQ(attribute_vector.get(position), ValueID{expected}) << "bit width " << static_cast<int>(bit_width);
+    }
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, Decode) {
+  BitPackedAttributeVector attribute_vector{1000, 9};
+  for (auto position = size_t{0}; position < attribute_vector.size(); ++position) {
+    attribute_vector.set(position, ValueID{static_cast<uint32_t>(position % 300)});
+  }
+
+  std::vector<ValueID> decoded(500);
+  attribute_vector.decode(333, decoded.size(), decoded.data());
+
+  for (auto index = size_t{0}; index < decoded.size(); ++index) {
+    EXPECT_EQ(decoded[index], ValueID{static_cast<uint32_t>((333 + index) % 300)});
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, WidthAndMemoryUsage) {
+  BitPackedAttributeVector attribute_vector{1000, 9};
+
+  EXPECT_EQ(attribute_vector.size(), 1000u);
+  EXPECT_EQ(attribute_vector.bit_width(), 9u);
+  EXPECT_EQ(attribute_vector.width(), 2u);
+  // 9000 bits fit into 141 words, plus one padding word
+  EXPECT_EQ(attribute_vector.estimate_memory_usage(), 142u * 8u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bloom_filter.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  auto filter = BloomFilter{1000};
+  for (auto value = 0; value < 1000; ++value) filter.insert(value * 7);
+  for (auto value = 0; value < 1000; ++value) EXPECT_TRUE(filter.may_contain(value * 7));
+
+  auto string_filter = BloomFilter{3};
+  for (const auto& value : {"Bill", "Steve", "Hasso"}) string_filter.insert(std::string{value});
+  EXPECT_TRUE(string_filter.may_contain(std::string{"Steve"}));
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  for (const auto false_positive_rate : {0.1, 0.01}) {
+    auto filter = BloomFilter{10'000, false_positive_rate};
+    for (auto value = int64_t{0}; value < 10'000; ++value) filter.insert(value);
+
+    auto false_positive_count = 0;
+    for (auto value = int64_t{10'000}; value < 110'000; ++value) false_positive_count += filter.may_contain(value);
+    EXPECT_LT(false_positive_count / 100'000.0, false_positive_rate * 1.5);
+  }
+}
+
+TEST_F(StorageBloomFilterTest, MemoryUsage) {
+  // a false-positive rate of 1% needs about 10.5 bits per value, i.e., 21 blocks of 512 bits for 1000 values
+  const auto filter = BloomFilter{1000, 0.01};
+  EXPECT_EQ(filter.hash_function_count(), 7u);
+  EXPECT_EQ(filter.block_count(), 21u);
+  EXPECT_EQ(filter.estimate_memory_usage(), 21u * 64u);
+
+  // even an empty filter has one block
+  EXPECT_EQ(BloomFilter{0}.block_count(), 1u);
+
+  EXPECT_THROW(BloomFilter(10, 0.0), std::logic_error);
+}
+
+}  // namespace opossum
@@ -1,4 +1,5 @@
 #include <memory>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -66,4 +67,16 @@ TEST_F(StorageChunkTest, UnknownSegmentType) {
   }
 }
 
+TEST_F(StorageChunkTest, SortedBy) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  EXPECT_TRUE(c.sorted_by().empty());
+
+  c.set_sorted_by(ColumnID{1});
+  c.set_sorted_by(ColumnID{1});
+  EXPECT_FALSE(c.is_sorted_by(ColumnID{0}));
+  EXPECT_TRUE(c.is_sorted_by(ColumnID{1}));
+  EXPECT_EQ(c.sorted_by(), std::vector<ColumnID>{ColumnID{1}});
+}
+
 }  // namespace opossum
@@ -0,0 +1,112 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/cold_segment.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/group_key_index.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/segment_encoding_utils.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageColdSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto i = 0; i < 10'000; ++i) {
+      vc_int->append(i % 100);
+      vc_str->append("2019-11-" + std::to_string(10 + i % 20));
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageColdSegmentTest, LazyDecompressionOfValueSegment) {
+  auto cold_segment = ColdSegment{"string", vc_str};
+
+  EXPECT_EQ(cold_segment.size(), 10'000u);
+  EXPECT_FALSE(cold_segment.encoding_spec());
+  EXPECT_FALSE(cold_segment.is_decompressed());
+  EXPECT_EQ(cold_segment.estimate_memory_usage(), cold_segment.compressed_size());
+  EXPECT_LT(cold_segment.compressed_size() * 10, vc_str->estimate_memory_usage());
+
+  EXPECT_EQ(cold_segment[ChunkOffset{25}], AllTypeVariant{"2019-11-15"});
+  EXPECT_TRUE(cold_segment.is_decompressed());
+  const auto segment = std::dynamic_pointer_cast<ValueSegment<std::string>>(cold_segment.segment());
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->values(), vc_str->values());
+
+  cold_segment.evict();
+  EXPECT_FALSE(cold_segment.is_decompressed());
+  EXPECT_THROW(cold_segment.append("x"), std::runtime_error);
+}
+
+TEST_F(StorageColdSegmentTest, KeepsEncoding) {
+  const auto dictionary_segment =
+      encode_segment("int", vc_int, {EncodingType::Dictionary, AttributeVectorEncoding::BitPacked});
+  auto cold_segment = ColdSegment{"int", dictionary_segment};
+
+  ASSERT_TRUE(cold_segment.encoding_spec());
+  EXPECT_EQ(cold_segment.encoding_spec()->encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(cold_segment.encoding_spec()->attribute_vector_encoding, AttributeVectorEncoding::BitPacked);
+
+  const auto segment = std::dynamic_pointer_cast<DictionarySegment<int>>(cold_segment.segment());
+  ASSERT_TRUE(segment);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < vc_int->size(); ++chunk_offset) {
+    ASSERT_EQ(segment->get(chunk_offset), vc_int->values()[chunk_offset]);
+  }
+
+  const auto run_length_segment = encode_segment("int", vc_int, {EncodingType::RunLength});
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int>>(ColdSegment{"int", run_length_segment}.segment()));
+}
+
+TEST_F(StorageColdSegmentTest, DemoteColdChunks) {
+  auto table = Table{4};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  for (auto i = 0; i < 10; ++i) table.append({i, std::to_string(i)});
+  table.compress_chunk(ChunkID{1});
+
+  // chunks that were scanned recently stay as they are
+  EXPECT_EQ(table.demote_cold_chunks(std::chrono::hours{1}), 0u);
+
+  // the last chunk is never demoted
+  EXPECT_EQ(table.demote_cold_chunks(std::chrono::seconds{0}), 2u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ColdSegment>(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0})));
+  EXPECT_FALSE(std::dynamic_pointer_cast<ColdSegment>(table.get_chunk(ChunkID{2}).get_segment(ColumnID{0})));
+
+  const auto cold_segment =
+      std::dynamic_pointer_cast<ColdSegment>(table.get_chunk(ChunkID{1}).get_segment(ColumnID{1}));
+  ASSERT_TRUE(cold_segment);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(cold_segment->segment()));
+  EXPECT_EQ((*cold_segment)[ChunkOffset{2}], AllTypeVariant{"6"});
+
+  // demoting again releases the decompressed segments, but does not count the chunks as demoted
+  EXPECT_EQ(table.demote_cold_chunks(std::chrono::seconds{0}), 0u);
+  EXPECT_FALSE(cold_segment->is_decompressed());
+}
+
+TEST_F(StorageColdSegmentTest, DemoteColdChunksDropsChunkIndexes) {
+  auto table = Table{4};
+  table.add_column("a", "int");
+  for (auto i = 0; i < 8; ++i) table.append({i});
+  table.compress_chunk(ChunkID{0});
+  table.get_chunk(ChunkID{0}).create_index<GroupKeyIndex>(ColumnID{0});
+  const auto b_plus_tree_index = table.create_b_plus_tree_index({ColumnID{0}});
+  ASSERT_EQ(table.get_chunk(ChunkID{0}).get_indexes(ColumnID{0}).size(), 1u);
+
+  // the index would keep the dictionary segment in memory
+  EXPECT_EQ(table.demote_cold_chunks(std::chrono::seconds{0}), 1u);
+  EXPECT_TRUE(table.get_chunk(ChunkID{0}).get_indexes(ColumnID{0}).empty());
+  EXPECT_EQ(table.get_b_plus_tree_index({ColumnID{0}}), b_plus_tree_index);
+}
+
+}  // namespace opossum
@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/delta_segment.hpp"
+#include "../../lib/storage/encoding_advisor.hpp"
+#include "../../lib/storage/segment_encoding_utils.hpp"
+#include "../../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageDeltaSegmentTest : public BaseTest {
+ protected:
+  template <typename T>
+  static void expect_scan_matches(const DeltaSegment<T>& delta_col, const std::vector<T>& values,
+                                  const std::vector<T>& search_values) {
+    for (const auto search_value : search_values) {
+      for (const auto scan_type :
+           {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan, ScanType::OpLessThanEquals,
+            ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+        auto expected = std::vector<ChunkOffset>{};
+        with_comparator(scan_type, [&](auto comparator) {
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+            if (comparator(values[chunk_offset], search_value)) expected.push_back(chunk_offset);
+          }
+        });
+
+        auto matches = std::vector<ChunkOffset>{};
+        delta_col.scan(scan_type, search_value, matches);
+        EXPECT_EQ(matches, expected) << "search value " << search_value;
+      }
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> vc_int = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<int64_t>> vc_long = std::make_shared<ValueSegment<int64_t>>();
+};
+
+TEST_F(StorageDeltaSegmentTest, AutoIncrementNeedsNoBits) {
+  for (auto i = 0; i < 1000; ++i) vc_int->append(i + 1);
+
+  auto delta_col = DeltaSegment<int32_t>{vc_int};
+
+  EXPECT_EQ(delta_col.size(), 1000u);
+  EXPECT_TRUE(delta_col.is_sorted());
+  EXPECT_EQ(delta_col.block_count(), 8u);
+  for (const auto bit_width : delta_col.bit_widths()) EXPECT_EQ(bit_width, 0u);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1000; ++chunk_offset) {
+    ASSERT_EQ(delta_col.get(chunk_offset), static_cast<int32_t>(chunk_offset + 1));
+  }
+  EXPECT_EQ(delta_col[ChunkOffset{999}], AllTypeVariant{1000});
+
+  // anchors, min deltas, bit widths, word offsets and a single padding word
+  EXPECT_EQ(delta_col.estimate_memory_usage(), 8u * (2 * sizeof(int32_t) + 1 + 4) + 8u);
+}
+
+TEST_F(StorageDeltaSegmentTest, NearSortedTimestamps) {
+  // timestamps that are mostly increasing, with some late arrivals
+  for (auto i = int64_t{0}; i < 5000; ++i) {
+    vc_long->append(int64_t{1'500'000'000'000} + i * 1000 - (i % 11 == 0 ? 3500 : 0));
+  }
+
+  auto delta_col = DeltaSegment<int64_t>{vc_long};
+  const auto& values = vc_long->values();
+
+  EXPECT_FALSE(delta_col.is_sorted());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    ASSERT_EQ(delta_col.get(chunk_offset), values[chunk_offset]);
+  }
+  EXPECT_LT(delta_col.estimate_memory_usage(), values.size() * sizeof(int64_t) / 4);
+  expect_scan_matches(delta_col, values, {values[0], values[11], values[2500], int64_t{0}});
+}
+
+TEST_F(StorageDeltaSegmentTest, ExtremeValues) {
+  for (auto value : {std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(), 0, -5,
+                     std::numeric_limits<int32_t>::max()}) {
+    vc_int->append(value);
+  }
+
+  auto delta_col = DeltaSegment<int32_t>{vc_int};
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 5; ++chunk_offset) {
+    EXPECT_EQ(delta_col.get(chunk_offset), vc_int->values()[chunk_offset]);
+  }
+}
+
+TEST_F(StorageDeltaSegmentTest, SortedScanUsesBounds) {
+  // duplicates that span block boundaries
+  for (auto i = 0; i < 2000; ++i) vc_int->append(i / 300 * 10);
+
+  auto delta_col = DeltaSegment<int32_t>{vc_int};
+  const auto& values = vc_int->values();
+
+  EXPECT_TRUE(delta_col.is_sorted());
+  EXPECT_EQ(delta_col.lower_bound(10), 300u);
+  EXPECT_EQ(delta_col.upper_bound(10), 600u);
+  EXPECT_EQ(delta_col.lower_bound(-1), 0u);
+  EXPECT_EQ(delta_col.lower_bound(61), 2000u);
+  expect_scan_matches(delta_col, values, {-1, 0, 5, 10, 60, 61});
+}
+
+TEST_F(StorageDeltaSegmentTest, EncodeSegment) {
+  for (auto i = 0; i < 20'000; ++i) vc_int->append(1'000'000 + 3 * i);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<DeltaSegment<int32_t>>(
+      encode_segment("int", vc_int, SegmentEncodingSpec{EncodingType::Delta})));
+  EXPECT_THROW(encode_segment("double", std::make_shared<ValueSegment<double>>(), {EncodingType::Delta}),
+               std::logic_error);
+
+  // a constant stride is smaller as deltas than as offsets to a block minimum
+  const auto decision = EncodingAdvisor{}.advise_segment("int", vc_int);
+  EXPECT_EQ(decision.characteristics.average_delta_bit_width, 0.0);
+  EXPECT_EQ(decision.chosen_spec.encoding_type, EncodingType::Delta);
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_encoder.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class StorageDictionaryEncoderTest : public BaseTest {};
+
+TEST_F(StorageDictionaryEncoderTest, SortedUniqueDictionary) {
+  const auto values = std::vector<std::string>{"Bill", "Steve", "Alexander", "Steve", "Hasso", "Bill"};
+  const auto result = encode_dictionary(values, AttributeVectorEncoding::FixedSize);
+
+  EXPECT_EQ(*result.dictionary, (std::vector<std::string>{"Alexander", "Bill", "Hasso", "Steve"}));
+  ASSERT_EQ(result.attribute_vector->size(), values.size());
+  for (auto position = size_t{0}; position < values.size(); ++position) {
+    EXPECT_EQ((*result.dictionary)[result.attribute_vector->get(position)], values[position]);
+  }
+}
+
+TEST_F(StorageDictionaryEncoderTest, EmptyInput) {
+  const auto result = encode_dictionary(std::vector<int>{}, AttributeVectorEncoding::BitPacked);
+  EXPECT_TRUE(result.dictionary->empty());
+  EXPECT_EQ(result.attribute_vector->size(), 0u);
+}
+
+TEST_F(StorageDictionaryEncoderTest, LargeInputAllAttributeVectorEncodings) {
+  // large enough to be split into ranges that are encoded in parallel
+  auto values = std::vector<int>(600'000);
+  for (auto position = size_t{0}; position < values.size(); ++position) {
+    values[position] = static_cast<int>((position * 2654435761u) % 70'000) - 35'000;
+  }
+
+  for (const auto encoding : {AttributeVectorEncoding::FixedSize, AttributeVectorEncoding::BitPacked,
+                              AttributeVectorEncoding::SimdBp128}) {
+    const auto result = encode_dictionary(values, encoding);
+    const auto& dictionary = *result.dictionary;
+
+    EXPECT_TRUE(std::is_sorted(dictionary.cbegin(), dictionary.cend()));
+    EXPECT_EQ(std::adjacent_find(dictionary.cbegin(), dictionary.cend()), dictionary.cend());
+    ASSERT_EQ(result.attribute_vector->size(), values.size());
+    for (auto position = size_t{0}; position < values.size(); ++position) {
+      ASSERT_EQ(dictionary[result.attribute_vector->get(position)], values[position]) << "position " << position;
+    }
+  }
+}
+
+}  // namespace opossum
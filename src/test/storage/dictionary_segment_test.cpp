@@ -120,4 +120,22 @@ TEST_F(StorageDictionarySegmentTest, DifferentDatasetSizes) {
 
   EXPECT_EQ(dict_col->attribute_vector()->width(), 4);
 }
+
+TEST_F(StorageDictionarySegmentTest, BitPackedAttributeVector) {
+  for (int i = 0; i < 300; i++) vc_int->append(i % 150);
+
+  auto col = std::make_shared<DictionarySegment<int>>(vc_int, AttributeVectorEncoding::BitPacked);
+
+  const auto attribute_vector = std::dynamic_pointer_cast<const BitPackedAttributeVector>(col->attribute_vector());
+  ASSERT_TRUE(attribute_vector);
+  EXPECT_EQ(attribute_vector->bit_width(), 8u);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 300; ++chunk_offset) {
+    EXPECT_EQ(col->get(chunk_offset), static_cast<int>(chunk_offset % 150));
+  }
+
+  // 150 dictionary entries and 300 value ids with 8 bits each (38 words plus one padding word)
+  EXPECT_EQ(col->estimate_memory_usage(), 150u * 4u + 39u * 8u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,112 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/encoding_advisor.hpp"
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/front_coded_dictionary_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageEncodingAdvisorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto i = 0; i < 20'000; ++i) {
+      // few long runs
+      vc_sorted->append(i / 5'000);
+      // unique values in a narrow range
+      vc_narrow->append(1'000'000 + (i * 7919) % 20'000);
+      // few distinct values without runs
+      vc_low_cardinality->append((i * 7) % 10);
+      // long strings that share prefixes
+      vc_str->append("https://shop.example.com/products/item-" + std::to_string(i));
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int>> vc_sorted = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<int>> vc_narrow = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<int>> vc_low_cardinality = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageEncodingAdvisorTest, Characteristics) {
+  const auto advisor = EncodingAdvisor{};
+
+  const auto sorted_decision = advisor.advise_segment("int", vc_sorted);
+  EXPECT_EQ(sorted_decision.characteristics.row_count, 20'000u);
+  EXPECT_EQ(sorted_decision.characteristics.sampled_row_count, EncodingAdvisor::default_sample_size);
+  EXPECT_EQ(sorted_decision.characteristics.estimated_distinct_count, 4u);
+  EXPECT_GT(sorted_decision.characteristics.average_run_length, 100.0);
+  EXPECT_EQ(sorted_decision.characteristics.frame_of_reference_bit_width, uint8_t{1});
+
+  const auto narrow_decision = advisor.advise_segment("int", vc_narrow);
+  EXPECT_EQ(narrow_decision.characteristics.estimated_distinct_count, 20'000u);
+  EXPECT_EQ(narrow_decision.characteristics.frame_of_reference_bit_width, uint8_t{15});
+
+  const auto string_decision = advisor.advise_segment("string", vc_str);
+  EXPECT_FALSE(string_decision.characteristics.frame_of_reference_bit_width);
+  EXPECT_GT(string_decision.characteristics.average_string_length, 40.0);
+  EXPECT_LT(string_decision.characteristics.average_front_coded_length,
+            string_decision.characteristics.average_string_length);
+}
+
+TEST_F(StorageEncodingAdvisorTest, SmallestMemory) {
+  const auto advisor = EncodingAdvisor{EncodingGoal::SmallestMemory};
+
+  EXPECT_EQ(advisor.advise_segment("int", vc_sorted).chosen_spec.encoding_type, EncodingType::RunLength);
+  EXPECT_EQ(advisor.advise_segment("int", vc_narrow).chosen_spec.encoding_type, EncodingType::FrameOfReference);
+  EXPECT_EQ(advisor.advise_segment("string", vc_str).chosen_spec.encoding_type, EncodingType::FrontCodedDictionary);
+
+  const auto low_cardinality_spec = advisor.advise_segment("int", vc_low_cardinality).chosen_spec;
+  EXPECT_EQ(low_cardinality_spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_NE(low_cardinality_spec.attribute_vector_encoding, AttributeVectorEncoding::FixedSize);
+}
+
+TEST_F(StorageEncodingAdvisorTest, FastestScan) {
+  const auto advisor = EncodingAdvisor{EncodingGoal::FastestScan};
+
+  EXPECT_EQ(advisor.advise_segment("int", vc_sorted).chosen_spec.encoding_type, EncodingType::RunLength);
+
+  const auto low_cardinality_spec = advisor.advise_segment("int", vc_low_cardinality).chosen_spec;
+  EXPECT_EQ(low_cardinality_spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(low_cardinality_spec.attribute_vector_encoding, AttributeVectorEncoding::FixedSize);
+}
+
+TEST_F(StorageEncodingAdvisorTest, CompressChunkRecordsDecisions) {
+  auto table = Table{};
+  table.add_column("sorted", "int");
+  table.add_column("narrow", "int");
+  table.add_column("url", "string");
+  for (auto i = ChunkOffset{0}; i < vc_sorted->size(); ++i) {
+    table.append({(*vc_sorted)[i], (*vc_narrow)[i], (*vc_str)[i]});
+  }
+
+  auto advisor = EncodingAdvisor{};
+  table.compress_chunk(ChunkID{0}, advisor);
+
+  const auto& chunk = table.get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int>>(chunk.get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int>>(chunk.get_segment(ColumnID{1})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<FrontCodedDictionarySegment>(chunk.get_segment(ColumnID{2})));
+
+  const auto decisions = advisor.decisions();
+  ASSERT_EQ(decisions.size(), 3u);
+  for (auto column_id = ColumnID{0}; column_id < 3; ++column_id) {
+    EXPECT_EQ(decisions[column_id].chunk_id, ChunkID{0});
+    EXPECT_EQ(decisions[column_id].column_id, column_id);
+    EXPECT_EQ(decisions[column_id].column_type, table.column_type(column_id));
+    EXPECT_FALSE(decisions[column_id].candidates.empty());
+  }
+
+  advisor.clear_decisions();
+  EXPECT_TRUE(advisor.decisions().empty());
+}
+
+}  // namespace opossum
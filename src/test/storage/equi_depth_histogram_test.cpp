@@ -0,0 +1,86 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/equi_depth_histogram.hpp"
+
+namespace opossum {
+
+class StorageEquiDepthHistogramTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // the values 1 to 10, each occurring once, except for 5, which occurs 11 times
+    for (auto value = 1; value <= 10; ++value) {
+      values.push_back(value);
+      counts.push_back(value == 5 ? 11 : 1);
+    }
+  }
+
+  std::vector<int> values;
+  std::vector<size_t> counts;
+};
+
+TEST_F(StorageEquiDepthHistogramTest, FromValueCounts) {
+  const auto histogram = EquiDepthHistogram<int>::from_value_counts(values, counts, 4);
+  EXPECT_EQ(histogram->total_count(), 20u);
+  EXPECT_EQ(histogram->total_distinct_count(), 10u);
+
+  // a value never spans two bins, so the bin of the frequent value is higher than the others
+  ASSERT_EQ(histogram->bin_count(), 4u);
+  EXPECT_EQ(histogram->bin_minimum(0), 1);
+  EXPECT_EQ(histogram->bin_maximum(0), 5);
+  EXPECT_EQ(histogram->bin_height(0), 15u);
+  EXPECT_EQ(histogram->bin_distinct_count(0), 5u);
+  EXPECT_EQ(histogram->bin_minimum(1), 6);
+  EXPECT_EQ(histogram->bin_maximum(3), 10);
+  EXPECT_EQ(histogram->bin_height(1) + histogram->bin_height(2) + histogram->bin_height(3), 5u);
+}
+
+TEST_F(StorageEquiDepthHistogramTest, EstimateCardinality) {
+  const auto histogram = EquiDepthHistogram<int>::from_value_counts(values, counts, 20);
+
+  // with one bin per value, the estimates are exact
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpEquals, 5), 11.0);
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpNotEquals, 5), 9.0);
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpLessThan, 5), 4.0);
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpLessThanEquals, 5), 15.0);
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpGreaterThan, 5), 5.0);
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpGreaterThanEquals, 5), 16.0);
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpEquals, 11), 0.0);
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpGreaterThan, AllTypeVariant{int64_t{0}}), 20.0);
+
+  // within a bin, values are assumed to be distributed uniformly
+  const auto single_bin = EquiDepthHistogram<int>::from_value_counts(values, counts, 1);
+  EXPECT_DOUBLE_EQ(single_bin->estimate_cardinality(ScanType::OpEquals, 5), 2.0);
+  EXPECT_DOUBLE_EQ(single_bin->estimate_cardinality(ScanType::OpLessThan, 6), 10.0);
+}
+
+TEST_F(StorageEquiDepthHistogramTest, Strings) {
+  const auto histogram = EquiDepthHistogram<std::string>::from_value_counts({"a", "b", "c", "d"}, {1, 1, 1, 1}, 2);
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpLessThan, std::string{"c"}), 2.0);
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpLessThan, std::string{"b"}), 1.0);
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpEquals, std::string{"ab"}), 1.0);
+  EXPECT_DOUBLE_EQ(histogram->estimate_cardinality(ScanType::OpEquals, std::string{"bb"}), 0.0);
+}
+
+TEST_F(StorageEquiDepthHistogramTest, Merge) {
+  const auto first = EquiDepthHistogram<int>::from_value_counts({1, 2, 3, 4}, {10, 10, 10, 10}, 4);
+  const auto second = EquiDepthHistogram<int>::from_value_counts({3, 4, 5, 6}, {10, 10, 10, 10}, 4);
+  const auto merged =
+      EquiDepthHistogram<int>::merge(std::vector<std::shared_ptr<const EquiDepthHistogram<int>>>{first, second}, 3);
+
+  EXPECT_EQ(merged->total_count(), 80u);
+  ASSERT_EQ(merged->bin_count(), 3u);
+  EXPECT_EQ(merged->bin_minimum(0), 1);
+  EXPECT_EQ(merged->bin_maximum(2), 6);
+
+  // overlapping bins cannot have more distinct values than their range
+  EXPECT_LE(merged->total_distinct_count(), 8u);
+  EXPECT_GE(merged->total_distinct_count(), 6u);
+  EXPECT_DOUBLE_EQ(merged->estimate_cardinality(ScanType::OpLessThan, 7), 80.0);
+}
+
+}  // namespace opossum
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/frame_of_reference_segment.hpp"
+#include "../../lib/storage/segment_encoding_utils.hpp"
+#include "../../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> vc_int = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<int64_t>> vc_long = std::make_shared<ValueSegment<int64_t>>();
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, GetValue) {
+  // timestamps with a narrow range per block, but a wide range overall
+  for (auto i = int64_t{0}; i < 5000; ++i) vc_long->append(int64_t{1'500'000'000'000} + i * 1000 + (i % 7));
+
+  auto for_col = FrameOfReferenceSegment<int64_t>{vc_long};
+
+  EXPECT_EQ(for_col.size(), 5000u);
+  EXPECT_EQ(for_col.block_minima()->size(), 3u);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 5000; ++chunk_offset) {
+    ASSERT_EQ(for_col.get(chunk_offset), vc_long->values()[chunk_offset]);
+  }
+  EXPECT_EQ(for_col[ChunkOffset{4999}], vc_long->operator[](ChunkOffset{4999}));
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, NegativeAndExtremeValues) {
+  for (auto value : {-5, std::numeric_limits<int32_t>::min(), 0, std::numeric_limits<int32_t>::max(), 17}) {
+    vc_int->append(value);
+  }
+
+  auto for_col = FrameOfReferenceSegment<int32_t>{vc_int};
+
+  EXPECT_EQ(for_col.offsets()->bit_width(), 32u);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 5; ++chunk_offset) {
+    EXPECT_EQ(for_col.get(chunk_offset), vc_int->values()[chunk_offset]);
+  }
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, ScanMatchesAllScanTypes) {
+  for (auto i = 0; i < 5000; ++i) vc_int->append((i * 7919) % 3000 - 1000);
+  auto for_col = FrameOfReferenceSegment<int32_t>{vc_int};
+  const auto& values = vc_int->values();
+
+  for (const auto search_value : {-2000, -1000, 0, 17, 1999, 5000}) {
+    for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                 ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+      auto expected = std::vector<ChunkOffset>{};
+      with_comparator(scan_type, [&](auto comparator) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+          if (comparator(values[chunk_offset], search_value)) expected.push_back(chunk_offset);
+        }
+      });
+
+      auto matches = std::vector<ChunkOffset>{};
+      for_col.scan(scan_type, search_value, matches);
+      EXPECT_EQ(matches, expected) << "search value " << search_value;
+    }
+  }
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, MemoryUsage) {
+  for (auto i = 0; i < 4096; ++i) vc_int->append(1'000'000 + i % 16);
+
+  auto for_col = FrameOfReferenceSegment<int32_t>{vc_int};
+
+  // two block minima and 4 bits per value (256 words plus one padding word)
+  EXPECT_EQ(for_col.estimate_memory_usage(), 2u * sizeof(int32_t) + 257u * 8u);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, OnlyIntegralTypes) {
+  auto vc_float = std::make_shared<ValueSegment<float>>();
+  vc_float->append(1.0f);
+
+  EXPECT_THROW(encode_segment("float", vc_float, SegmentEncodingSpec{EncodingType::FrameOfReference}),
+               std::logic_error);
+  EXPECT_TRUE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(
+      encode_segment("int", vc_int, SegmentEncodingSpec{EncodingType::FrameOfReference})));
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/dictionary_segment.hpp"
+#include "../../lib/storage/front_coded_dictionary.hpp"
+#include "../../lib/storage/front_coded_dictionary_segment.hpp"
+#include "../../lib/storage/segment_encoding_utils.hpp"
+#include "../../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionarySegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // URLs share long prefixes, which is where front coding pays off
+    for (auto i = 0; i < 100; ++i) {
+      urls.push_back("https://shop.example.com/products/category-" + std::to_string(i % 7) + "/item-" +
+                     std::to_string(1000 + i));
+    }
+    for (const auto& url : urls) vc_str->append(url);
+  }
+
+  std::vector<std::string> urls;
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, DictionaryLookups) {
+  const auto sorted_values = std::vector<std::string>{"", "a", "ab", "abc", "abd", "b", "ba", "bab", "c"};
+  const auto dictionary = FrontCodedDictionary{sorted_values};
+
+  EXPECT_EQ(dictionary.size(), sorted_values.size());
+  for (auto value_id = ValueID{0}; value_id < sorted_values.size(); ++value_id) {
+    EXPECT_EQ(dictionary.value_by_value_id(value_id), sorted_values[value_id]);
+    EXPECT_EQ(dictionary.lower_bound(sorted_values[value_id]), value_id);
+    EXPECT_EQ(dictionary.upper_bound(sorted_values[value_id]), ValueID{value_id + 1});
+  }
+
+  EXPECT_EQ(dictionary.lower_bound("aa"), ValueID{2});
+  EXPECT_EQ(dictionary.upper_bound("aa"), ValueID{2});
+  EXPECT_EQ(dictionary.lower_bound("d"), ValueID{9});
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, BoundsAcrossBlocks) {
+  auto sorted_values = std::vector<std::string>{};
+  for (auto i = 0; i < 1000; i += 2) sorted_values.push_back("value_" + std::to_string(10000 + i));
+  const auto dictionary = FrontCodedDictionary{sorted_values};
+
+  for (auto i = 0; i < 1000; ++i) {
+    const auto search_value = "value_" + std::to_string(10000 + i);
+    const auto expected_lower = std::lower_bound(sorted_values.cbegin(), sorted_values.cend(), search_value);
+    const auto expected_upper = std::upper_bound(sorted_values.cbegin(), sorted_values.cend(), search_value);
+    ASSERT_EQ(dictionary.lower_bound(search_value), static_cast<uint32_t>(expected_lower - sorted_values.cbegin()));
+    ASSERT_EQ(dictionary.upper_bound(search_value), static_cast<uint32_t>(expected_upper - sorted_values.cbegin()));
+  }
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, SegmentMatchesDictionarySegment) {
+  const auto plain_segment = DictionarySegment<std::string>{vc_str};
+  const auto front_coded_segment = FrontCodedDictionarySegment{vc_str};
+
+  EXPECT_EQ(front_coded_segment.size(), plain_segment.size());
+  EXPECT_EQ(front_coded_segment.unique_values_count(), plain_segment.unique_values_count());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < urls.size(); ++chunk_offset) {
+    EXPECT_EQ(front_coded_segment.get(chunk_offset), urls[chunk_offset]);
+    EXPECT_EQ(front_coded_segment[chunk_offset], AllTypeVariant{urls[chunk_offset]});
+  }
+
+  for (const auto& search_value : {std::string{"https://"}, urls[5], urls[42] + "0", std::string{"zzz"}}) {
+    EXPECT_EQ(front_coded_segment.lower_bound(search_value), plain_segment.lower_bound(search_value));
+    EXPECT_EQ(front_coded_segment.upper_bound(search_value), plain_segment.upper_bound(search_value));
+  }
+  EXPECT_EQ(front_coded_segment.lower_bound(std::string{"zzz"}), INVALID_VALUE_ID);
+
+  // the compressed dictionary is several times smaller than a vector of std::strings with their heap buffers
+  auto plain_dictionary_size = size_t{0};
+  for (const auto& url : *plain_segment.dictionary()) plain_dictionary_size += sizeof(std::string) + url.size();
+  EXPECT_LT(front_coded_segment.dictionary()->estimate_memory_usage() * 3, plain_dictionary_size);
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, EncodeSegment) {
+  const auto segment = encode_segment("string", vc_str, {EncodingType::FrontCodedDictionary});
+  EXPECT_TRUE(std::dynamic_pointer_cast<FrontCodedDictionarySegment>(segment));
+  EXPECT_THROW(segment->append("x"), std::runtime_error);
+
+  auto vc_int = std::make_shared<ValueSegment<int>>();
+  EXPECT_THROW(encode_segment("int", vc_int, {EncodingType::FrontCodedDictionary}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,113 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/group_key_index.hpp"
+#include "../lib/storage/segment_encoding_utils.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageGroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    vc_str = std::make_shared<ValueSegment<std::string>>();
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"}) {
+      vc_str->append(value);
+    }
+    dict_segment = encode_segment("string", vc_str, SegmentEncodingSpec{EncodingType::Dictionary});
+    index = std::make_shared<GroupKeyIndex>(dict_segment);
+  }
+
+  std::vector<ChunkOffset> range_lookup(const IndexBound& lower, const IndexBound& upper) const {
+    auto matches = std::vector<ChunkOffset>{};
+    index->range_lookup(lower, upper, matches);
+    return matches;
+  }
+
+  std::vector<ChunkOffset> scan(const ScanType scan_type, const AllTypeVariant& value) const {
+    auto matches = std::vector<ChunkOffset>{};
+    index->scan(scan_type, value, matches);
+    return matches;
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> vc_str;
+  std::shared_ptr<BaseSegment> dict_segment;
+  std::shared_ptr<GroupKeyIndex> index;
+};
+
+TEST_F(StorageGroupKeyIndexTest, IndexOffsets) {
+  // dictionary: apple, charlie, delta, frank, hotel, inbox
+  EXPECT_EQ(index->value_start_offsets(), (std::vector<ChunkOffset>{0, 1, 3, 5, 6, 7, 8}));
+  EXPECT_EQ(index->positions(), (std::vector<ChunkOffset>{4, 5, 6, 1, 3, 2, 0, 7}));
+  EXPECT_EQ(index->estimate_memory_usage(), 15 * sizeof(ChunkOffset));
+  EXPECT_TRUE(index->is_index_for(dict_segment));
+  EXPECT_FALSE(index->is_index_for(vc_str));
+  EXPECT_EQ(index->type(), SegmentIndexType::GroupKey);
+}
+
+TEST_F(StorageGroupKeyIndexTest, PointLookup) {
+  auto matches = std::vector<ChunkOffset>{};
+  index->point_lookup("delta", matches);
+  EXPECT_EQ(matches, (std::vector<ChunkOffset>{1, 3}));
+
+  // lookups append to the result
+  index->point_lookup("inbox", matches);
+  EXPECT_EQ(matches, (std::vector<ChunkOffset>{1, 3, 7}));
+
+  matches.clear();
+  index->point_lookup("bravo", matches);
+  index->point_lookup("zulu", matches);
+  EXPECT_TRUE(matches.empty());
+}
+
+TEST_F(StorageGroupKeyIndexTest, RangeLookup) {
+  EXPECT_EQ(range_lookup({"charlie", true}, {"frank", true}), (std::vector<ChunkOffset>{5, 6, 1, 3, 2}));
+  EXPECT_EQ(range_lookup({"charlie", false}, {"frank", false}), (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(range_lookup({"b", true}, {"e", true}), (std::vector<ChunkOffset>{5, 6, 1, 3}));
+  EXPECT_EQ(range_lookup({std::nullopt, true}, {"charlie", false}), (std::vector<ChunkOffset>{4}));
+  EXPECT_EQ(range_lookup({"hotel", true}, {std::nullopt, true}), (std::vector<ChunkOffset>{0, 7}));
+  EXPECT_EQ(range_lookup({std::nullopt, true}, {std::nullopt, true}).size(), 8u);
+  EXPECT_TRUE(range_lookup({"frank", true}, {"delta", true}).empty());
+  EXPECT_TRUE(range_lookup({"x", true}, {"z", true}).empty());
+}
+
+TEST_F(StorageGroupKeyIndexTest, Scan) {
+  EXPECT_EQ(scan(ScanType::OpEquals, "charlie"), (std::vector<ChunkOffset>{5, 6}));
+  EXPECT_EQ(scan(ScanType::OpNotEquals, "charlie"), (std::vector<ChunkOffset>{4, 1, 3, 2, 0, 7}));
+  EXPECT_EQ(scan(ScanType::OpLessThan, "delta"), (std::vector<ChunkOffset>{4, 5, 6}));
+  EXPECT_EQ(scan(ScanType::OpLessThanEquals, "delta"), (std::vector<ChunkOffset>{4, 5, 6, 1, 3}));
+  EXPECT_EQ(scan(ScanType::OpGreaterThan, "frank"), (std::vector<ChunkOffset>{0, 7}));
+  EXPECT_EQ(scan(ScanType::OpGreaterThanEquals, "frank"), (std::vector<ChunkOffset>{2, 0, 7}));
+}
+
+TEST_F(StorageGroupKeyIndexTest, RequiresDictionarySegment) {
+  EXPECT_THROW(GroupKeyIndex{vc_str}, std::logic_error);
+  const auto front_coded_segment =
+      encode_segment("string", vc_str, SegmentEncodingSpec{EncodingType::FrontCodedDictionary});
+  EXPECT_EQ(GroupKeyIndex{front_coded_segment}.positions(), index->positions());
+}
+
+TEST_F(StorageGroupKeyIndexTest, OwnedByChunk) {
+  auto chunk = Chunk{};
+  chunk.add_segment(dict_segment);
+  EXPECT_EQ(chunk.get_index(ColumnID{0}, SegmentIndexType::GroupKey), nullptr);
+
+  const auto chunk_index = chunk.create_index<GroupKeyIndex>(ColumnID{0});
+  EXPECT_EQ(chunk.get_index(ColumnID{0}, SegmentIndexType::GroupKey), chunk_index);
+  EXPECT_EQ(chunk.get_indexes(ColumnID{0}).size(), 1u);
+
+  chunk.remove_index(chunk_index);
+  EXPECT_TRUE(chunk.get_indexes(ColumnID{0}).empty());
+
+  // replacing a segment drops its indexes
+  chunk.create_index<GroupKeyIndex>(ColumnID{0});
+  chunk.replace_segment(ColumnID{0}, encode_segment("string", vc_str, SegmentEncodingSpec{EncodingType::Dictionary}));
+  EXPECT_TRUE(chunk.get_indexes(ColumnID{0}).empty());
+}
+
+}  // namespace opossum
@@ -0,0 +1,110 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/hash_index.hpp"
+#include "../lib/storage/segment_encoding_utils.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageHashIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    vc_str = std::make_shared<ValueSegment<std::string>>();
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "delta"}) {
+      vc_str->append(value);
+    }
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> vc_str;
+};
+
+TEST_F(StorageHashIndexTest, HashTable) {
+  auto hash_table = HashTable<int64_t, ChunkOffset>{};
+  for (auto value = int64_t{0}; value < 10'000; ++value) hash_table.insert(value * 31, static_cast<ChunkOffset>(value));
+  hash_table.insert(31, 20'000);
+  EXPECT_EQ(hash_table.size(), 10'001u);
+  EXPECT_EQ(hash_table.value_count(), 10'000u);
+
+  // buckets hold at most six values and are doubled when they fill up
+  EXPECT_GE(hash_table.bucket_count() * 6, 10'000u);
+  EXPECT_LT(hash_table.bucket_count() * 3, 10'000u);
+  EXPECT_GE(hash_table.estimate_memory_usage(), hash_table.bucket_count() * 64 + 10'000 * sizeof(int64_t));
+
+  for (auto value = int64_t{0}; value < 10'000; ++value) {
+    auto matches = std::vector<ChunkOffset>{};
+    hash_table.lookup(value * 31, matches);
+    ASSERT_EQ(matches.size(), value == 1 ? 2u : 1u);
+    EXPECT_EQ(matches.front(), value);
+  }
+
+  auto matches = std::vector<ChunkOffset>{};
+  hash_table.lookup(30, matches);
+  hash_table.lookup(-31, matches);
+  EXPECT_TRUE(matches.empty());
+}
+
+TEST_F(StorageHashIndexTest, PointLookup) {
+  const auto dict_segment = encode_segment("string", vc_str, SegmentEncodingSpec{EncodingType::Dictionary});
+  for (const auto& segment : {std::shared_ptr<BaseSegment>{vc_str}, dict_segment}) {
+    const auto index = HashIndex<std::string>{segment};
+    EXPECT_EQ(index.type(), SegmentIndexType::Hash);
+    EXPECT_FALSE(index.supports_range_lookups());
+
+    auto matches = std::vector<ChunkOffset>{};
+    index.point_lookup("delta", matches);
+    EXPECT_EQ(matches, (std::vector<ChunkOffset>{1, 3, 7}));
+
+    matches.clear();
+    index.scan(ScanType::OpEquals, "apple", matches);
+    EXPECT_EQ(matches, (std::vector<ChunkOffset>{4}));
+
+    matches.clear();
+    index.point_lookup("dolta", matches);
+    EXPECT_TRUE(matches.empty());
+    EXPECT_THROW(index.scan(ScanType::OpLessThan, "delta", matches), std::logic_error);
+  }
+}
+
+TEST_F(StorageHashIndexTest, InsertsAppendedRows) {
+  auto chunk = Chunk{};
+  chunk.add_segment(std::make_shared<ValueSegment<float>>());
+  const auto index = chunk.create_index<HashIndex<float>>(ColumnID{0});
+  chunk.append({1.5f});
+  chunk.append({-0.0f});
+  chunk.append({0.0f});
+
+  auto matches = std::vector<ChunkOffset>{};
+  index->point_lookup(0.0f, matches);
+  EXPECT_EQ(matches, (std::vector<ChunkOffset>{1, 2}));
+  EXPECT_EQ(chunk.estimate_index_memory_usage(), index->estimate_memory_usage());
+}
+
+TEST_F(StorageHashIndexTest, TableHashIndex) {
+  auto table = Table{3};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  table.append({1, "x"});
+  table.append({2, "y"});
+  table.append({3, "x"});
+  table.append({4, "z"});
+  table.compress_chunk(ChunkID{0});
+
+  const auto index = table.create_hash_index(ColumnID{1});
+  EXPECT_EQ(table.get_hash_index(ColumnID{1}), index);
+  EXPECT_EQ(table.get_hash_index(ColumnID{0}), nullptr);
+  EXPECT_EQ(table.estimate_index_memory_usage(), index->estimate_memory_usage());
+
+  table.append({5, "x"});
+  EXPECT_EQ(*index->point_lookup("x"), (PosList{{ChunkID{0}, 0}, {ChunkID{0}, 2}, {ChunkID{1}, 1}}));
+  EXPECT_EQ(*index->point_lookup("z"), (PosList{{ChunkID{1}, 0}}));
+  EXPECT_TRUE(index->point_lookup("w")->empty());
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/materialize.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/segment_encoding_utils.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageMaterializeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto i = 0; i < 3000; ++i) vc_int->append(i / 7 * 3);
+  }
+
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+};
+
+TEST_F(StorageMaterializeTest, AllSegmentTypes) {
+  const auto& expected = vc_int->values();
+  const auto offsets = std::vector<ChunkOffset>{2999, 0, 1500, 7, 7};
+  const auto expected_at_offsets = std::vector<int>{expected[2999], expected[0], expected[1500], 3, 3};
+
+  auto segments = std::vector<std::shared_ptr<BaseSegment>>{vc_int};
+  for (const auto& spec : {SegmentEncodingSpec{EncodingType::Dictionary, AttributeVectorEncoding::FixedSize},
+                           SegmentEncodingSpec{EncodingType::Dictionary, AttributeVectorEncoding::SimdBp128},
+                           SegmentEncodingSpec{EncodingType::RunLength}, SegmentEncodingSpec{EncodingType::Delta},
+                           SegmentEncodingSpec{EncodingType::FrameOfReference}}) {
+    segments.push_back(encode_segment("int", vc_int, spec));
+  }
+
+  for (const auto& segment : segments) {
+    auto values = std::vector<int>{};
+    materialize_values(*segment, values);
+    EXPECT_EQ(values, expected);
+
+    // values are appended
+    materialize_values(*segment, values, &offsets);
+    EXPECT_EQ(std::vector<int>(values.cbegin() + 3000, values.cend()), expected_at_offsets);
+  }
+}
+
+TEST_F(StorageMaterializeTest, ReferenceSegment) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "string");
+  for (auto i = 0; i < 10; ++i) table->append({"value_" + std::to_string(i)});
+  table->compress_chunk(ChunkID{0});
+
+  const auto pos_list = std::make_shared<PosList>(
+      PosList{{ChunkID{2}, 1}, {ChunkID{0}, 3}, {ChunkID{1}, 0}, {ChunkID{0}, 0}, {ChunkID{2}, 0}});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+
+  auto values = std::vector<std::string>{"existing"};
+  materialize_values(reference_segment, values);
+  EXPECT_EQ(values,
+            (std::vector<std::string>{"existing", "value_9", "value_3", "value_4", "value_0", "value_8"}));
+
+  values.clear();
+  const auto offsets = std::vector<ChunkOffset>{4, 0};
+  materialize_values(reference_segment, values, &offsets);
+  EXPECT_EQ(values, (std::vector<std::string>{"value_8", "value_9"}));
+
+  // positions in a single chunk
+  const auto single_chunk_segment =
+      ReferenceSegment{table, ColumnID{0}, std::make_shared<PosList>(PosList{{ChunkID{0}, 2}, {ChunkID{0}, 1}})};
+  values.clear();
+  materialize_values(single_chunk_segment, values);
+  EXPECT_EQ(values, (std::vector<std::string>{"value_2", "value_1"}));
+}
+
+}  // namespace opossum
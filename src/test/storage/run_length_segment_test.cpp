@@ -0,0 +1,70 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../lib/resolve_type.hpp"
+#include "../../lib/storage/run_length_segment.hpp"
+#include "../../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentInt) {
+  for (auto value : {3, 3, 3, 1, 1, 3, 7}) vc_int->append(value);
+
+  auto col = make_shared_by_data_type<BaseSegment, RunLengthSegment>("int", vc_int);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthSegment<int>>(col);
+
+  EXPECT_EQ(rle_col->size(), 7u);
+  EXPECT_EQ(rle_col->run_count(), 4u);
+  EXPECT_EQ(*rle_col->values(), (std::vector<int>{3, 1, 3, 7}));
+  EXPECT_EQ(*rle_col->end_positions(), (std::vector<ChunkOffset>{2, 4, 5, 6}));
+}
+
+TEST_F(StorageRunLengthSegmentTest, GetValue) {
+  for (auto run = 0; run < 10; ++run) {
+    for (auto i = 0; i < run + 1; ++i) vc_str->append(std::to_string(run));
+  }
+
+  auto rle_col = RunLengthSegment<std::string>{vc_str};
+
+  auto chunk_offset = ChunkOffset{0};
+  for (auto run = 0; run < 10; ++run) {
+    for (auto i = 0; i < run + 1; ++i, ++chunk_offset) {
+      EXPECT_EQ(rle_col.get(chunk_offset), std::to_string(run));
+      EXPECT_EQ(rle_col[chunk_offset], AllTypeVariant{std::to_string(run)});
+    }
+  }
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  auto rle_col = RunLengthSegment<int>{vc_int};
+
+  EXPECT_EQ(rle_col.size(), 0u);
+  EXPECT_EQ(rle_col.run_count(), 0u);
+}
+
+TEST_F(StorageRunLengthSegmentTest, AppendValue) {
+  vc_int->append(1);
+  auto rle_col = RunLengthSegment<int>{vc_int};
+
+  EXPECT_THROW(rle_col.append(2), std::runtime_error);
+}
+
+TEST_F(StorageRunLengthSegmentTest, MemoryUsage) {
+  for (auto i = 0; i < 1000; ++i) vc_int->append(i / 500);
+
+  auto rle_col = RunLengthSegment<int>{vc_int};
+
+  EXPECT_EQ(rle_col.estimate_memory_usage(), 2u * sizeof(int) + 2u * sizeof(ChunkOffset));
+}
+
+}  // namespace opossum
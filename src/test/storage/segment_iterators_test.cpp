@@ -0,0 +1,85 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/cold_segment.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/segment_encoding_utils.hpp"
+#include "../lib/storage/segment_iterators.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentIteratorsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto i = 0; i < 1000; ++i) vc_int->append((i * 17) % 300);
+  }
+
+  template <typename T>
+  static std::vector<std::pair<ChunkOffset, T>> collect(const BaseSegment& segment) {
+    auto positions = std::vector<std::pair<ChunkOffset, T>>{};
+    segment_with_iterators<T>(segment, [&](auto it, const auto end) {
+      for (; it != end; ++it) {
+        const auto position = *it;
+        positions.emplace_back(position.chunk_offset(), position.value());
+      }
+    });
+    return positions;
+  }
+
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+};
+
+TEST_F(StorageSegmentIteratorsTest, AllSegmentTypes) {
+  auto expected = std::vector<std::pair<ChunkOffset, int>>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < vc_int->size(); ++chunk_offset) {
+    expected.emplace_back(chunk_offset, vc_int->values()[chunk_offset]);
+  }
+
+  EXPECT_EQ(collect<int>(*vc_int), expected);
+  for (const auto attribute_vector_encoding :
+       {AttributeVectorEncoding::FixedSize, AttributeVectorEncoding::BitPacked, AttributeVectorEncoding::SimdBp128}) {
+    const auto segment = encode_segment("int", vc_int, {EncodingType::Dictionary, attribute_vector_encoding});
+    EXPECT_EQ(collect<int>(*segment), expected);
+  }
+  // segment types without a specialized iterator
+  EXPECT_EQ(collect<int>(*encode_segment("int", vc_int, {EncodingType::RunLength})), expected);
+  // ColdSegments are iterated as the segment they rebuild
+  EXPECT_EQ(collect<int>(ColdSegment{"int", encode_segment("int", vc_int, {EncodingType::Dictionary})}), expected);
+}
+
+TEST_F(StorageSegmentIteratorsTest, IteratorArithmetic) {
+  segment_with_iterators<int>(*vc_int, [&](auto begin, const auto end) {
+    EXPECT_EQ(end - begin, 1000);
+    EXPECT_EQ((*(begin + 10)).value(), vc_int->values()[10]);
+    EXPECT_EQ((*(end - 1)).chunk_offset(), 999u);
+  });
+}
+
+TEST_F(StorageSegmentIteratorsTest, ReferenceSegment) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "string");
+  for (auto i = 0; i < 10; ++i) table->append({"value_" + std::to_string(i)});
+  table->compress_chunk(ChunkID{1});
+
+  // positions out of order and in several chunks, one of them dictionary-encoded
+  const auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{0}, 2}, {ChunkID{0}, 0}, {ChunkID{1}, 1},
+                                                          {ChunkID{1}, 0}, {ChunkID{3}, 0}, {ChunkID{0}, 1}});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+
+  auto call_count = 0;
+  segment_with_iterators<std::string>(reference_segment, [&](auto, auto) { ++call_count; });
+  EXPECT_EQ(call_count, 4);
+
+  const auto expected = std::vector<std::pair<ChunkOffset, std::string>>{
+      {0, "value_2"}, {1, "value_0"}, {2, "value_4"}, {3, "value_3"}, {4, "value_9"}, {5, "value_1"}};
+  EXPECT_EQ(collect<std::string>(reference_segment), expected);
+}
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/segment_encoding_utils.hpp"
+#include "../lib/storage/segment_statistics.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto i = 0; i < 100; ++i) vc_int->append(10 + i % 20 * 2);
+  }
+
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+};
+
+TEST_F(StorageSegmentStatisticsTest, AllSegmentTypes) {
+  auto segments = std::vector<std::shared_ptr<BaseSegment>>{vc_int};
+  for (const auto& spec : {SegmentEncodingSpec{EncodingType::Dictionary}, SegmentEncodingSpec{EncodingType::RunLength},
+                           SegmentEncodingSpec{EncodingType::Delta}}) {
+    segments.push_back(encode_segment("int", vc_int, spec));
+  }
+
+  for (const auto& segment : segments) {
+    const auto statistics = compute_segment_statistics("int", *segment);
+    ASSERT_NE(statistics, nullptr);
+    EXPECT_EQ(statistics->min(), AllTypeVariant{10});
+    EXPECT_EQ(statistics->max(), AllTypeVariant{48});
+    EXPECT_EQ(statistics->distinct_count(), 20u);
+    EXPECT_TRUE(statistics->is_null_free());
+  }
+
+  EXPECT_EQ(compute_segment_statistics("int", ValueSegment<int>{}), nullptr);
+}
+
+TEST_F(StorageSegmentStatisticsTest, FrontCodedDictionary) {
+  auto vc_str = std::make_shared<ValueSegment<std::string>>();
+  for (const auto& value : {"Bill", "Steve", "Alexander", "Steve", "Hasso"}) vc_str->append(value);
+
+  const auto segment = encode_segment("string", vc_str, SegmentEncodingSpec{EncodingType::FrontCodedDictionary});
+  const auto statistics = compute_segment_statistics("string", *segment);
+  EXPECT_EQ(statistics->min(), AllTypeVariant{"Alexander"});
+  EXPECT_EQ(statistics->max(), AllTypeVariant{"Steve"});
+  EXPECT_EQ(statistics->distinct_count(), 4u);
+}
+
+TEST_F(StorageSegmentStatisticsTest, CanPrune) {
+  const auto statistics = SegmentStatistics<int>{10, 20, 5};
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 9));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, 10));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, 20));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 21));
+
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpNotEquals, 10));
+  EXPECT_TRUE(SegmentStatistics<int>(7, 7, 1).can_prune(ScanType::OpNotEquals, 7));
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThan, 10));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThan, 11));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThanEquals, 9));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThanEquals, 10));
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThan, 20));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThan, 19));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThanEquals, 21));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThanEquals, 20));
+
+  // the search value is cast to the segment's type
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, AllTypeVariant{int64_t{25}}));
+}
+
+TEST_F(StorageSegmentStatisticsTest, BloomFilter) {
+  const auto segment = encode_segment("int", vc_int, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto without_filter = compute_segment_statistics<int>(*segment);
+  const auto with_filter = compute_segment_statistics<int>(*segment, 0.01);
+  ASSERT_NE(with_filter->bloom_filter(), nullptr);
+  EXPECT_EQ(without_filter->bloom_filter(), nullptr);
+  EXPECT_EQ(with_filter->estimate_memory_usage(),
+            without_filter->estimate_memory_usage() + with_filter->bloom_filter()->estimate_memory_usage());
+
+  // the segment holds the even values from 10 to 48, so odd values within that range are only pruned by the filter
+  EXPECT_FALSE(without_filter->can_prune(ScanType::OpEquals, 25));
+  EXPECT_TRUE(with_filter->can_prune(ScanType::OpEquals, 25));
+  for (auto value = 10; value <= 48; value += 2) EXPECT_FALSE(with_filter->can_prune(ScanType::OpEquals, value));
+
+  // other scan types do not use the filter
+  EXPECT_FALSE(with_filter->can_prune(ScanType::OpNotEquals, 25));
+}
+
+TEST_F(StorageSegmentStatisticsTest, ComputedByCompressChunk) {
+  auto table = Table{3};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  for (auto i = 0; i < 4; ++i) table.append({i, std::to_string(9 - i)});
+  table.compress_chunk(ChunkID{0});
+
+  const auto& compressed_chunk = table.get_chunk(ChunkID{0});
+  EXPECT_EQ(compressed_chunk.get_statistics(ColumnID{0})->max(), AllTypeVariant{2});
+  EXPECT_EQ(compressed_chunk.get_statistics(ColumnID{1})->min(), AllTypeVariant{"7"});
+
+  // chunks that are still being appended to have no statistics
+  EXPECT_EQ(table.get_chunk(ChunkID{1}).get_statistics(ColumnID{0}), nullptr);
+
+  // Bloom filters are only built for columns that ask for them
+  table.set_bloom_filter_false_positive_rate(ColumnID{1}, 0.05);
+  table.append({4, "5"});
+  table.append({5, "4"});
+  table.compress_chunk(ChunkID{1});
+  const auto& chunk = table.get_chunk(ChunkID{1});
+  const auto int_statistics =
+      std::dynamic_pointer_cast<const SegmentStatistics<int>>(chunk.get_statistics(ColumnID{0}));
+  const auto string_statistics =
+      std::dynamic_pointer_cast<const SegmentStatistics<std::string>>(chunk.get_statistics(ColumnID{1}));
+  EXPECT_EQ(int_statistics->bloom_filter(), nullptr);
+  EXPECT_NE(string_statistics->bloom_filter(), nullptr);
+  EXPECT_EQ(table.bloom_filter_false_positive_rate(ColumnID{1}), 0.05);
+  EXPECT_THROW(table.set_bloom_filter_false_positive_rate(ColumnID{0}, 1.0), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,121 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/simd_bp128_attribute_vector.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class StorageSimdBp128AttributeVectorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // blocks with growing bit widths, a block of zeros, and an incomplete last block
+    for (auto block_index = uint32_t{0}; block_index <= 32; ++block_index) {
+      const auto max_value = block_index == 32 ? ~uint32_t{0} : (uint32_t{1} << block_index) - 1;
+      for (auto index = uint32_t{0}; index < 128; ++index) {
+        value_ids.emplace_back((index * 2654435761u + block_index) & max_value);
+      }
+    }
+    for (auto index = uint32_t{0}; index < 50; ++index) {
+      value_ids.emplace_back(index * 7);
+    }
+  }
+
+  std::vector<ValueID> value_ids;
+};
+
+TEST_F(StorageSimdBp128AttributeVectorTest, Get) {
+  const auto attribute_vector = SimdBp128AttributeVector{value_ids};
+
+  EXPECT_EQ(attribute_vector.size(), value_ids.size());
+  EXPECT_EQ(attribute_vector.width(), 4u);
+  for (auto position = size_t{0}; position < value_ids.size(); ++position) {
+    ASSERT_EQ(attribute_vector.get(position), value_ids[position]) << "position " << position;
+  }
+}
+
+TEST_F(StorageSimdBp128AttributeVectorTest, AllKernelsDecodeEqually) {
+  const auto attribute_vector = SimdBp128AttributeVector{value_ids};
+  const auto block_count = (value_ids.size() + SimdBp128AttributeVector::block_size - 1) / 128;
+
+  for (const auto kernel : {SimdBp128AttributeVector::Kernel::Scalar, SimdBp128AttributeVector::Kernel::Sse2,
+                            SimdBp128AttributeVector::Kernel::Avx2}) {
+    if (!SimdBp128AttributeVector::is_supported(kernel)) continue;
+
+    auto decoded = std::vector<ValueID>(block_count * SimdBp128AttributeVector::block_size);
+    for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+      attribute_vector.decode_block(block_index, decoded.data() + block_index * 128, kernel);
+    }
+
+    for (auto position = size_t{0}; position < value_ids.size(); ++position) {
+      ASSERT_EQ(decoded[position], value_ids[position]) << "kernel " << static_cast<int>(kernel);
+    }
+  }
+}
+
+TEST_F(StorageSimdBp128AttributeVectorTest, ZeroWidthLastBlock) {
+  // a block of width 0 stores no words, so reading it must not touch the data after the last stored block
+  auto tail_of_zeros = std::vector<ValueID>(128, ValueID{3});
+  tail_of_zeros.resize(256 + 40, ValueID{0});
+  for (const auto& zeros : {std::vector<ValueID>(5, ValueID{0}), tail_of_zeros}) {
+    const auto attribute_vector = SimdBp128AttributeVector{zeros};
+    for (auto position = size_t{0}; position < zeros.size(); ++position) {
+      ASSERT_EQ(attribute_vector.get(position), zeros[position]) << "position " << position;
+    }
+
+    for (const auto kernel : {SimdBp128AttributeVector::Kernel::Scalar, SimdBp128AttributeVector::Kernel::Sse2,
+                              SimdBp128AttributeVector::Kernel::Avx2}) {
+      if (!SimdBp128AttributeVector::is_supported(kernel)) continue;
+
+      const auto last_block_index = (zeros.size() - 1) / SimdBp128AttributeVector::block_size;
+      auto decoded = std::vector<ValueID>(SimdBp128AttributeVector::block_size, ValueID{1});
+      attribute_vector.decode_block(last_block_index, decoded.data(), kernel);
+      EXPECT_EQ(decoded, std::vector<ValueID>(SimdBp128AttributeVector::block_size, ValueID{0}));
+    }
+  }
+}
+
+TEST_F(StorageSimdBp128AttributeVectorTest, DecodeUnalignedRange) {
+  const auto attribute_vector = SimdBp128AttributeVector{value_ids};
+
+  auto decoded = std::vector<ValueID>(1000);
+  attribute_vector.decode(100, decoded.size(), decoded.data());
+  for (auto index = size_t{0}; index < decoded.size(); ++index) {
+    EXPECT_EQ(decoded[index], value_ids[100 + index]);
+  }
+
+  // the last block is incomplete
+  decoded.resize(60);
+  attribute_vector.decode(value_ids.size() - 60, decoded.size(), decoded.data());
+  for (auto index = size_t{0}; index < decoded.size(); ++index) {
+    EXPECT_EQ(decoded[index], value_ids[value_ids.size() - 60 + index]);
+  }
+}
+
+TEST_F(StorageSimdBp128AttributeVectorTest, IsImmutable) {
+  auto attribute_vector = SimdBp128AttributeVector{value_ids};
+  EXPECT_THROW(attribute_vector.set(0, ValueID{1}), std::logic_error);
+}
+
+TEST_F(StorageSimdBp128AttributeVectorTest, MemoryUsage) {
+  // three blocks with 2 bits each need 3 * 4 * 2 words, plus padding and per-block metadata
+  const auto attribute_vector = SimdBp128AttributeVector{std::vector<ValueID>(300, ValueID{3})};
+  EXPECT_EQ(attribute_vector.estimate_memory_usage(), (3u * 8u + 4u) * 4u + 3u * 1u + 3u * 4u);
+}
+
+TEST_F(StorageSimdBp128AttributeVectorTest, DictionarySegmentEncoding) {
+  auto value_segment = std::make_shared<ValueSegment<int>>();
+  for (auto value = 0; value < 1000; ++value) value_segment->append(value % 300);
+
+  const auto dictionary_segment = DictionarySegment<int>{value_segment, AttributeVectorEncoding::SimdBp128};
+  EXPECT_TRUE(std::dynamic_pointer_cast<const SimdBp128AttributeVector>(dictionary_segment.attribute_vector()));
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1000; ++chunk_offset) {
+    EXPECT_EQ(dictionary_segment.get(chunk_offset), static_cast<int>(chunk_offset % 300));
+  }
+}
+
+}  // namespace opossum
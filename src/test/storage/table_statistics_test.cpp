@@ -0,0 +1,74 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/equi_depth_histogram.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/table_statistics.hpp"
+
+namespace opossum {
+
+class StorageTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table.add_column("id", "int");
+    table.add_column("name", "string");
+    for (auto i = 0; i < 1000; ++i) table.append({i, "name_" + std::to_string(i % 10)});
+  }
+
+  Table table{250};
+};
+
+TEST_F(StorageTableStatisticsTest, KeptUpToDateByCompressChunk) {
+  EXPECT_EQ(table.table_statistics()->row_count(), 0u);
+  EXPECT_EQ(table.table_statistics()->histogram(ColumnID{0}), nullptr);
+  EXPECT_DOUBLE_EQ(table.table_statistics()->estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 3), 1.0);
+
+  table.compress_chunk(ChunkID{0});
+  const auto statistics = table.table_statistics();
+  EXPECT_EQ(statistics->row_count(), 250u);
+  EXPECT_EQ(statistics->distinct_count(ColumnID{0}), 250u);
+  EXPECT_EQ(statistics->distinct_count(ColumnID{1}), 10u);
+  EXPECT_DOUBLE_EQ(statistics->null_fraction(ColumnID{1}), 0.0);
+
+  table.compress_chunk(ChunkID{1});
+  table.compress_chunk(ChunkID{2});
+  table.compress_chunk(ChunkID{3});
+  EXPECT_EQ(table.table_statistics()->row_count(), 1000u);
+  // the chunks share their names, but not their ids
+  EXPECT_EQ(table.table_statistics()->distinct_count(ColumnID{0}), 1000u);
+  EXPECT_EQ(table.table_statistics()->distinct_count(ColumnID{1}), 10u);
+  EXPECT_LE(table.table_statistics()->histogram(ColumnID{0})->bin_count(), TableStatistics::histogram_bin_count);
+
+  // earlier statistics are not modified
+  EXPECT_EQ(statistics->row_count(), 250u);
+}
+
+TEST_F(StorageTableStatisticsTest, MergedOnlyOnRequest) {
+  const auto statistics = table.table_statistics();
+  EXPECT_EQ(table.table_statistics(), statistics);
+
+  table.compress_chunk(ChunkID{0});
+  table.compress_chunk(ChunkID{1});
+  const auto merged_statistics = table.table_statistics();
+  EXPECT_NE(merged_statistics, statistics);
+  EXPECT_EQ(merged_statistics->row_count(), 500u);
+  EXPECT_EQ(table.table_statistics(), merged_statistics);
+}
+
+TEST_F(StorageTableStatisticsTest, EstimateSelectivity) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) table.compress_chunk(chunk_id);
+  const auto statistics = table.table_statistics();
+
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 100), 0.1, 0.01);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 900), 0.1, 0.01);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 500), 0.001, 0.001);
+  EXPECT_DOUBLE_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThan, 5000), 0.0);
+  EXPECT_DOUBLE_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpNotEquals, -1), 1.0);
+
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpEquals, "name_3"), 0.1, 0.01);
+}
+
+}  // namespace opossum
@@ -1,3 +1,4 @@
+#include <chrono>
 #include <limits>
 #include <memory>
 #include <string>
@@ -8,7 +9,11 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/cold_segment.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/type_cast.hpp"
 
 namespace opossum {
 
@@ -93,4 +98,86 @@ TEST_F(StorageTableTest, CompressChunk) {
   EXPECT_EQ(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0})->estimate_memory_usage(), 6u);
 }
 
+TEST_F(StorageTableTest, CompressChunkWithEncodingSpecs) {
+  t.append({4, "Hello,"});
+  t.append({4, "world"});
+
+  t.compress_chunk(ChunkID{0}, {SegmentEncodingSpec{EncodingType::RunLength},
+                                SegmentEncodingSpec{EncodingType::Dictionary, AttributeVectorEncoding::BitPacked}});
+
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  const auto run_length_segment = std::dynamic_pointer_cast<RunLengthSegment<int>>(chunk.get_segment(ColumnID{0}));
+  ASSERT_TRUE(run_length_segment);
+  EXPECT_EQ(run_length_segment->run_count(), 1u);
+
+  const auto dictionary_segment =
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk.get_segment(ColumnID{1}));
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitPackedAttributeVector>(dictionary_segment->attribute_vector()));
+  EXPECT_EQ(dictionary_segment->get(1), "world");
+}
+
+TEST_F(StorageTableTest, CompressChunkWithInvalidEncodingSpecs) {
+  t.append({4, "Hello,"});
+  t.append({4, "world"});
+  const auto segment = t.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+
+  const auto dictionary = SegmentEncodingSpec{EncodingType::Dictionary};
+  EXPECT_THROW(t.compress_chunk(ChunkID{0}, {dictionary}), std::logic_error);
+  EXPECT_THROW(t.compress_chunk(ChunkID{0}, {dictionary, SegmentEncodingSpec{EncodingType::FrameOfReference}}),
+               std::logic_error);
+  EXPECT_THROW(t.compress_chunk(ChunkID{0}, {dictionary, SegmentEncodingSpec{EncodingType::Delta}}), std::logic_error);
+  EXPECT_THROW(t.compress_chunk(ChunkID{0}, {SegmentEncodingSpec{EncodingType::FrontCodedDictionary}, dictionary}),
+               std::logic_error);
+
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0}), segment);
+  EXPECT_FALSE(t.get_chunk(ChunkID{0}).get_statistics(ColumnID{0}));
+}
+
+TEST_F(StorageTableTest, CompressChunkTwice) {
+  t.append({4, "Hello,"});
+  t.append({4, "world"});
+  t.compress_chunk(ChunkID{0});
+  const auto segment = t.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+
+  // only ValueSegments can be encoded
+  EXPECT_THROW(t.compress_chunk(ChunkID{0}), std::logic_error);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0}), segment);
+}
+
+TEST_F(StorageTableTest, CompressDemotedChunk) {
+  auto table = Table{4};
+  table.add_column("a", "int");
+  for (auto value = 0; value < 10; ++value) table.append({value});
+
+  EXPECT_EQ(table.demote_cold_chunks(std::chrono::seconds{0}), 2u);
+  ASSERT_TRUE(std::dynamic_pointer_cast<ColdSegment>(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0})));
+
+  // the ValueSegment that the ColdSegment rebuilds is encoded
+  table.compress_chunk(ChunkID{0});
+  const auto dictionary_segment =
+      std::dynamic_pointer_cast<DictionarySegment<int>>(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_EQ(dictionary_segment->size(), 4u);
+  EXPECT_EQ(dictionary_segment->get(3), 3);
+  EXPECT_TRUE(table.get_chunk(ChunkID{0}).is_sorted_by(ColumnID{0}));
+}
+
+TEST_F(StorageTableTest, CompressChunkWithFrameOfReferenceOverWideRange) {
+  auto table = Table{4};
+  table.add_column("a", "long");
+  table.append({int64_t{0}});
+  table.append({int64_t{1} << 40});
+  table.append({int64_t{5}});
+  const auto segment = table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+
+  // the range of the block does not fit into 32 bits
+  const auto frame_of_reference = SegmentEncodingSpec{EncodingType::FrameOfReference};
+  EXPECT_THROW(table.compress_chunk(ChunkID{0}, {frame_of_reference}), std::logic_error);
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}), segment);
+
+  table.compress_chunk(ChunkID{0}, {SegmentEncodingSpec{EncodingType::Delta}});
+  EXPECT_EQ(type_cast<int64_t>((*table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}))[1]), int64_t{1} << 40);
+}
+
 }  // namespace opossum
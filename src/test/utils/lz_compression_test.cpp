@@ -0,0 +1,56 @@
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/lz_compression.hpp"
+
+namespace opossum {
+
+class LZCompressionTest : public BaseTest {
+ protected:
+  static std::vector<char> round_trip(const std::string& input) {
+    return lz_decompress(lz_compress(input.data(), input.size()));
+  }
+};
+
+TEST_F(LZCompressionTest, RoundTrip) {
+  auto repetitive = std::string{};
+  for (auto i = 0; i < 1000; ++i) repetitive += "https://shop.example.com/products/item-" + std::to_string(i % 50);
+
+  auto pseudo_random = std::string{};
+  auto state = uint32_t{12345};
+  for (auto i = 0; i < 100'000; ++i) {
+    state = state * 1103515245u + 12345u;
+    pseudo_random.push_back(static_cast<char>(state >> 24));
+  }
+
+  for (const auto& input : {std::string{}, std::string{"a"}, std::string{"abcdefg"}, std::string(300, 'x'),
+                            std::string(70'000, '\0') + "end", repetitive, pseudo_random}) {
+    const auto output = round_trip(input);
+    EXPECT_EQ(std::string(output.cbegin(), output.cend()), input) << "input size " << input.size();
+  }
+}
+
+TEST_F(LZCompressionTest, CompressesRepetitiveData) {
+  auto input = std::string{};
+  for (auto i = 0; i < 1000; ++i) input += "2019-11-0" + std::to_string(i % 9) + " 12:00:00;";
+
+  const auto compressed = lz_compress(input.data(), input.size());
+  EXPECT_LT(compressed.size() * 10, input.size());
+}
+
+TEST_F(LZCompressionTest, RejectsMalformedInput) {
+  const auto input = std::string(1000, 'x');
+  auto compressed = lz_compress(input.data(), input.size());
+
+  auto truncated = std::vector<char>(compressed.cbegin(), compressed.cend() - 1);
+  EXPECT_THROW(lz_decompress(truncated), std::logic_error);
+
+  // announce more bytes than the data contains
+  compressed[0] = static_cast<char>(compressed[0] + 1);
+  EXPECT_THROW(lz_decompress(compressed), std::logic_error);
+}
+
+}  // namespace opossum